@@ -0,0 +1,109 @@
+/**
+ * @brief	  	Asymmetric multiprocessing (AMP) support for the two Cortex-A9 cores of the Zynq
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "AmpCore.h"
+#include "MemoryPool.h"
+#include "xil_cache.h"
+#include "xil_io.h"
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+#include <string.h>
+
+/** Global Variables **/
+AmpDoorbell ampDoorbell;
+
+void AmpMapShared()
+{
+	// Both cores must see the same attributes, otherwise a cached copy may hide the updates
+	Xil_SetTlbAttributes(AMP_SHARED_BASE, AMP_SHARED_ATTRIBUTES);
+}
+
+void AmpInitShared()
+{
+	AmpMapShared();
+
+	// Zero filled memory is an empty queue, see AmpQueue.h
+	memset(reinterpret_cast<void*>(AMP_SHARED_BASE), 0, AMP_SHARED_SIZE);
+
+	AmpControl& control = AmpGetControl();
+	control.cpu1State 	= AMP_CPU1_OFFLINE;
+
+	dmb();
+	control.magic = AMP_SHARED_MAGIC;
+}
+
+bool AmpStartCpu1(uint32_t entry)
+{
+	AmpControl& control = AmpGetControl();
+
+	if(AMP_SHARED_MAGIC != control.magic)
+		return false;
+
+	// The boot ROM of CPU1 jumps to this address once it is non-zero
+	Xil_Out32(AMP_CPU1_START_REGISTER, entry);
+	Xil_DCacheFlushRange(AMP_CPU1_START_REGISTER, sizeof(uint32_t));
+
+	dsb();
+	sev();
+
+	XTime start = 0, now = 0;
+	XTime_GetTime(&start);
+
+	while(AMP_CPU1_READY != control.cpu1State)
+	{
+		XTime_GetTime(&now);
+
+		if((now - start) > (XTime(COUNTS_PER_SECOND) / 1000000 * AMP_CPU1_START_TIMEOUT_US))
+			return false;
+	}
+
+	return true;
+}
+
+void AmpSignalReady()
+{
+	AmpMapShared();
+
+	dmb();
+	AmpGetControl().cpu1State = AMP_CPU1_READY;
+}
+
+void AmpDoorbellIrqHandler(AmpDoorbell* doorbell)
+{
+	++doorbell->rings;
+}
+
+void AmpNotify(XScuGic* gic, AmpCpu target)
+{
+	// Shared memory updates must be complete before the other core is interrupted
+	dsb();
+
+	XScuGic_SoftwareIntr(gic, AMP_DOORBELL_SGI_ID, (AMP_CPU0 == target) ? XSCUGIC_SPI_CPU0_MASK : XSCUGIC_SPI_CPU1_MASK);
+}
+
+uint32_t AmpWait(const AmpDoorbell& doorbell, uint32_t seen)
+{
+	{
+		// A pending interrupt wakes the core up from WFI even if it is masked
+		MemoryLock lock;
+
+		if(seen == doorbell.rings)
+			wfi();
+	}
+
+	// The doorbell handler runs here if it was the reason of the wake up
+	return doorbell.rings;
+}
+
+void AmpRouteInterrupt(XScuGic* gic, uint32_t id, AmpCpu target)
+{
+	const AmpCpu other = (AMP_CPU0 == target) ? AMP_CPU1 : AMP_CPU0;
+
+	XScuGic_InterruptUnmapFromCpu(gic, other, id);
+	XScuGic_InterruptMaptoCpu(gic, target, id);
+}
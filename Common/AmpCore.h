@@ -0,0 +1,101 @@
+/**
+ * @brief	  	Asymmetric multiprocessing (AMP) support for the two Cortex-A9 cores of the Zynq
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Each core runs its own standalone image. The FSBL loads both images and starts
+ * 				CPU0, CPU1 waits in the boot ROM. It sleeps with WFE and jumps to the address
+ * 				at 0xFFFFFFF0 once it is non-zero, AmpStartCpu1() writes the address and wakes
+ * 				CPU1 with SEV.
+ *
+ * 				Memory map of the Zedboard (512MB DDR):
+ * 				- CPU0: DDR 0x00100000 - 0x0FFFFFFF
+ * 				- CPU1: DDR 0x10000000 - 0x1FFFFFFF, the BSP must be built with -DUSE_AMP=1 so
+ * 				  that CPU1 leaves the L2 cache and the GIC distributor configured by CPU0 alone
+ * 				- Shared: High OCM 0xFFFF0000 - 0xFFFFBFFF, the top of the OCM is left to the
+ * 				  wait loop of the boot ROM
+ *
+ * 				The shared memory is mapped as shareable and non-cacheable on both cores, thus
+ * 				no cache maintenance is needed and a DMB is enough to order the accesses. The
+ * 				attribute applies to the whole 1MB section of the high OCM. The shared memory
+ * 				starts with an AmpControl block, the application places its own structure after
+ * 				it through AmpShared<T>().
+ *
+ * 				A core notifies the other one with a software generated interrupt (SGI), which
+ * 				only increments the doorbell counter of the receiving core. Both cores bind it
+ * 				in their vector tables:
+ *
+ * 				GIC_BIND(AMP_DOORBELL_SGI_ID, AmpDoorbellIrqHandler, &ampDoorbell)
+ *
+ * 				Shared peripheral interrupts are routed to CPU0 by default, AmpRouteInterrupt()
+ * 				moves one to the other core. Private interrupts such as the private timer are
+ * 				banked, each core has its own.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xscugic.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+#define AMP_CPU1_START_REGISTER 	0xFFFFFFF0		// Polled by the boot ROM of CPU1
+#define AMP_CPU1_IMAGE_BASE 		0x10000000		// Entry of the CPU1 image (start of its DDR region)
+#define AMP_CPU1_START_TIMEOUT_US 	100000
+
+#define AMP_SHARED_BASE 			0xFFFF0000
+#define AMP_SHARED_SIZE 			0xC000
+#define AMP_SHARED_ATTRIBUTES 		0x14DE2			// Shareable, non-cacheable, full access section
+#define AMP_SHARED_MAGIC 			0x414D5030		// "AMP0"
+
+#define AMP_DOORBELL_SGI_ID 		15
+
+/** Custom Structures **/
+enum AmpCpu : uint8_t{
+	AMP_CPU0 = 0,
+	AMP_CPU1 = 1
+};
+
+enum AmpCpu1State : uint32_t{
+	AMP_CPU1_OFFLINE = 0,
+	AMP_CPU1_READY
+};
+
+struct AmpControl{
+	volatile uint32_t magic;		// Set by CPU0 once the shared memory is initialized
+	volatile uint32_t cpu1State;
+};
+
+struct AmpDoorbell{
+	volatile uint32_t rings = 0;	// Notifications received by this core
+};
+
+/** Global Variables **/
+extern AmpDoorbell ampDoorbell;		// Each core has its own
+
+/** Shared Memory **/
+inline AmpControl& AmpGetControl()
+{
+	return *reinterpret_cast<AmpControl*>(AMP_SHARED_BASE);
+}
+
+// Structure of the application, placed after the control block
+template<typename T>
+T& AmpShared()
+{
+	constexpr size_t offset = (sizeof(AmpControl) + 63) & ~size_t(63);
+	static_assert((offset + sizeof(T)) <= AMP_SHARED_SIZE, "Shared structure doesn't fit into the shared memory!");
+
+	return *reinterpret_cast<T*>(AMP_SHARED_BASE + offset);
+}
+
+/** Function Declarations **/
+void 		AmpInitShared();											// CPU0, maps and clears the shared memory
+void 		AmpMapShared();												// CPU1, maps the shared memory
+bool 		AmpStartCpu1(uint32_t entry = AMP_CPU1_IMAGE_BASE);			// CPU0, waits until CPU1 reports ready
+void 		AmpSignalReady();											// CPU1, once its initialization is done
+void 		AmpDoorbellIrqHandler(AmpDoorbell* doorbell);				// Bound to AMP_DOORBELL_SGI_ID
+void 		AmpNotify(XScuGic* gic, AmpCpu target);						// Rings the doorbell of the other core
+uint32_t 	AmpWait(const AmpDoorbell& doorbell, uint32_t seen);		// Sleeps until the doorbell rings after "seen"
+void 		AmpRouteInterrupt(XScuGic* gic, uint32_t id, AmpCpu target);	// Shared peripheral interrupt to the given core
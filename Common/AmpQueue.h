@@ -0,0 +1,154 @@
+/**
+ * @brief	  	Lock-free single producer, single consumer queue between two cores
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Same idea as the RingBuffer, but the producer and the consumer run on different
+ * 				cores. A compiler barrier isn't enough there, the item has to be visible to the
+ * 				other core before the index that publishes it. The data memory barrier (DMB)
+ * 				orders the accesses of the core itself, the shared memory must be coherent or
+ * 				non-cacheable for the other core to see them (see AmpCore.h).
+ *
+ * 				The indices are placed on separate cache lines, thus the cores don't steal the
+ * 				line of each other's index at every update. The queue has no constructor with
+ * 				side effects, a zero filled memory is an empty queue. It must be placed in the
+ * 				shared memory by the application.
+ *
+ * 				Builds for a host too, the host threads then stand for the cores.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+#define AMP_CACHE_LINE_SIZE 	32		// L1 line size of the Cortex-A9
+
+#if defined(__arm__)
+#define AMP_BARRIER() 			__asm__ volatile("dmb" ::: "memory")
+#else
+#define AMP_BARRIER() 			__sync_synchronize()
+#endif
+
+template<typename T, size_t Capacity>
+class AmpQueue{
+	static_assert((0 != Capacity) && (0 == (Capacity & (Capacity - 1))), "Capacity must be a power of two!");
+
+public:
+	/**
+	 * @brief	Clears the queue, only one of the cores may call it while both are idle
+	 */
+	void Reset()
+	{
+		m_head 		= 0;
+		m_tail 		= 0;
+		m_overflows = 0;
+
+		AMP_BARRIER();
+	}
+
+	/**
+	 * @brief	Appends a single item (producer core)
+	 * @return	false if the queue is full, the item is dropped in that case
+	 */
+	bool Push(const T& item)
+	{
+		const uint32_t head = m_head;
+
+		if((head - m_tail) >= Capacity)
+		{
+			++m_overflows;
+
+			return false;
+		}
+
+		m_buffer[head & MASK] = item;
+
+		// Item must be visible before the index
+		AMP_BARRIER();
+		m_head = head + 1;
+
+		return true;
+	}
+
+	/**
+	 * @brief	Gives the slot of the next item to be filled in place (producer core)
+	 * @return	nullptr if the queue is full, Commit() publishes the slot
+	 */
+	T* Claim()
+	{
+		const uint32_t head = m_head;
+
+		if((head - m_tail) >= Capacity)
+			return nullptr;
+
+		// The slot is free only after the consumer has finished reading it
+		AMP_BARRIER();
+
+		return &m_buffer[head & MASK];
+	}
+
+	void Commit()
+	{
+		AMP_BARRIER();
+		m_head = m_head + 1;
+	}
+
+	/**
+	 * @brief	Removes the oldest item (consumer core)
+	 * @return	false if the queue is empty
+	 */
+	bool Pop(T& item)
+	{
+		const T* const slot = Peek();
+
+		if(nullptr == slot)
+			return false;
+
+		item = *slot;
+		Release();
+
+		return true;
+	}
+
+	/**
+	 * @brief	Gives the oldest item in place (consumer core)
+	 * @return	nullptr if the queue is empty, Release() frees the slot
+	 */
+	const T* Peek() const
+	{
+		const uint32_t tail = m_tail;
+
+		if(tail == m_head)
+			return nullptr;
+
+		// Item must be read after the index that published it
+		AMP_BARRIER();
+
+		return &m_buffer[tail & MASK];
+	}
+
+	void Release()
+	{
+		// Reading of the item must be completed before the slot is handed back
+		AMP_BARRIER();
+		m_tail = m_tail + 1;
+	}
+
+	size_t 		Size() 		const { return m_head - m_tail; 	}
+	bool 		IsEmpty() 	const { return m_head == m_tail; 	}
+	bool 		IsFull() 	const { return Size() >= Capacity; 	}
+	uint32_t 	Overflows() const { return m_overflows; 		}
+
+	static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	static constexpr uint32_t MASK = Capacity - 1;
+
+	alignas(AMP_CACHE_LINE_SIZE) volatile uint32_t 	m_head;			// Written only by the producer
+	volatile uint32_t 								m_overflows;
+	alignas(AMP_CACHE_LINE_SIZE) volatile uint32_t 	m_tail;			// Written only by the consumer
+	alignas(AMP_CACHE_LINE_SIZE) T 					m_buffer[Capacity];
+};
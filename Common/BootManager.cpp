@@ -0,0 +1,225 @@
+/**
+ * @brief	  	Table driven peripheral bring-up with boot profiles and timings
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Stage dependencies added.
+ * 				October 19, 2026 -> Dependency cycles fail instead of recursing.
+ */
+
+/** Libraries **/
+#include "BootManager.h"
+#include <stdio.h>
+
+/** Global Variables **/
+static const BootStage* stageTable 	= nullptr;
+static uint8_t 			stageCount 	= 0;
+static BootProfile 		profile 	= BOOT_PROFILE_FULL;
+static BootStageRecord 	records[BOOT_MAX_STAGES];
+static XTime 			bootStart 	= 0;
+static uint8_t 			stoppedAt 	= BOOT_INVALID_STAGE;	// Failed critical stage
+
+static const char* const statusNames[] = {
+	"PENDING",
+	"READY",
+	"TEST DEFERRED",
+	"INIT FAILED",
+	"TEST FAILED",
+	"DEP FAILED",
+	"IN PROGRESS"
+};
+
+static XTime Now()
+{
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	return now;
+}
+
+static uint32_t TicksToUs(const XTime ticks)
+{
+	return uint32_t((ticks * 1000000) / COUNTS_PER_SECOND);
+}
+
+static bool IsUsable(const BootStageStatus status)
+{
+	return (BOOT_STAGE_READY == status) || (BOOT_STAGE_TEST_DEFERRED == status);
+}
+
+/**
+ * @brief	Initializes a single stage and runs or defers its self-test
+ * @return	True if the stage is usable
+ */
+static bool BringUp(const uint8_t index)
+{
+	const BootStage& stage 	= stageTable[index];
+	BootStageRecord& record = records[index];
+
+	// Reaching this stage again while its dependencies are resolved means a cycle
+	record.status = BOOT_STAGE_IN_PROGRESS;
+
+	// A non-lazy dependency must be earlier in the table, a lazy one is brought up here
+	for(uint8_t idx = 0; idx < stageCount; ++idx)
+	{
+		if((0 == (stage.dependencies & BOOT_DEPENDS_ON(idx))) || (idx == index))
+			continue;
+
+		const bool b_lazy = (0 != (stageTable[idx].flags & BOOT_STAGE_LAZY));
+
+		if((!b_lazy && (idx > index)) || !BootRequire(idx))
+		{
+			record.status = BOOT_STAGE_DEPENDENCY_FAILED;
+			return false;
+		}
+	}
+
+	XTime start = Now();
+	const bool b_initOk = stage.init();
+	record.initTicks = Now() - start;
+
+	if(!b_initOk)
+	{
+		record.status = BOOT_STAGE_INIT_FAILED;
+		return false;
+	}
+
+	if(nullptr == stage.selfTest)
+	{
+		record.status = BOOT_STAGE_READY;
+	}
+	else if(BOOT_PROFILE_FULL == profile)
+	{
+		start = Now();
+		const bool b_testOk = stage.selfTest();
+		record.testTicks = Now() - start;
+
+		record.status = b_testOk ? BOOT_STAGE_READY : BOOT_STAGE_TEST_FAILED;
+	}
+	else if(0 != (stage.flags & BOOT_STAGE_TEST_DEFERRABLE))
+	{
+		record.status = BOOT_STAGE_TEST_DEFERRED;
+	}
+	else
+	{
+		record.status 		= BOOT_STAGE_READY;
+		record.b_testSkipped = true;
+	}
+
+	if(BOOT_STAGE_TEST_FAILED == record.status)
+		return false;
+
+	// Start time is a part of the initialization
+	if(nullptr != stage.start)
+	{
+		start = Now();
+		const bool b_startOk = stage.start();
+		record.initTicks += Now() - start;
+
+		if(!b_startOk)
+		{
+			record.status = BOOT_STAGE_INIT_FAILED;
+			return false;
+		}
+	}
+
+	record.readyAt = Now();
+
+	return true;
+}
+
+bool BootRun(const BootStage* stages, uint8_t count, BootProfile bootProfile)
+{
+	if((nullptr == stages) || (count > BOOT_MAX_STAGES))
+		return false;
+
+	stageTable 	= stages;
+	stageCount 	= count;
+	profile 	= bootProfile;
+	stoppedAt 	= BOOT_INVALID_STAGE;
+	bootStart 	= Now();
+
+	for(uint8_t idx = 0; idx < count; ++idx)
+		records[idx] = BootStageRecord{};
+
+	for(uint8_t idx = 0; idx < count; ++idx)
+	{
+		if(0 != (stages[idx].flags & BOOT_STAGE_LAZY))
+			continue;
+
+		if(!BringUp(idx) && (0 != (stages[idx].flags & BOOT_STAGE_CRITICAL)))
+		{
+			stoppedAt = idx;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool BootRequire(uint8_t stage)
+{
+	if(stage >= stageCount)
+		return false;
+
+	// Failures are not retried, the report keeps the first result. A stage in progress isn't
+	// usable, a cycle fails here instead of recursing.
+	if(BOOT_STAGE_PENDING == records[stage].status)
+		BringUp(stage);
+
+	return IsUsable(records[stage].status);
+}
+
+bool BootRunDeferredSelfTests()
+{
+	bool b_allPassed = true;
+
+	for(uint8_t idx = 0; idx < stageCount; ++idx)
+	{
+		BootStageRecord& record = records[idx];
+
+		if(BOOT_STAGE_TEST_DEFERRED != record.status)
+			continue;
+
+		const XTime start = Now();
+		const bool b_testOk = stageTable[idx].selfTest();
+		record.testTicks = Now() - start;
+
+		record.status = b_testOk ? BOOT_STAGE_READY : BOOT_STAGE_TEST_FAILED;
+		b_allPassed &= b_testOk;
+	}
+
+	return b_allPassed;
+}
+
+BootProfile BootGetProfile()
+{
+	return profile;
+}
+
+const BootStageRecord& BootGetRecord(uint8_t stage)
+{
+	static const BootStageRecord invalid{};
+
+	return (stage < stageCount) ? records[stage] : invalid;
+}
+
+void BootPrintReport()
+{
+	printf("Boot profile: %s\n", (BOOT_PROFILE_FAST == profile) ? "FAST" : "FULL");
+
+	for(uint8_t idx = 0; idx < stageCount; ++idx)
+	{
+		const BootStageRecord& record = records[idx];
+
+		printf("  %-12s %-13s init %6uus, test %6uus%s, ready at %7uus\n",
+				stageTable[idx].name,
+				statusNames[record.status],
+				unsigned(TicksToUs(record.initTicks)),
+				unsigned(TicksToUs(record.testTicks)),
+				record.b_testSkipped ? " (skipped)" : "",
+				unsigned(IsUsable(record.status) ? TicksToUs(record.readyAt - bootStart) : 0));
+	}
+
+	if(BOOT_INVALID_STAGE != stoppedAt)
+		printf("Boot stopped, critical stage %s failed!\n", stageTable[stoppedAt].name);
+}
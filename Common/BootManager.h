@@ -0,0 +1,85 @@
+/**
+ * @brief	  	Table driven peripheral bring-up with boot profiles and timings
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Stage dependencies added.
+ * 				October 19, 2026 -> Dependency cycles fail instead of recursing.
+ *
+ * @note		The application declares its peripherals as a table of stages. Each stage has a driver
+ * 				initialization, an optional self-test and an optional start function which configures
+ * 				and starts the verified peripheral. All of them return false on failure.
+ *
+ * 				BootRun() initializes the stages in table order, except the lazy ones which are
+ * 				initialized by the first BootRequire() call. In the full profile, each self-test runs
+ * 				right after its initialization. In the fast profile (e.g. after a watchdog reset),
+ * 				the self-tests are skipped, or deferred to BootRunDeferredSelfTests() if they are
+ * 				safe to run on a live peripheral (BOOT_STAGE_TEST_DEFERRABLE).
+ *
+ * 				A stage may depend on other stages (e.g. an interrupt driven peripheral on the GIC).
+ * 				It isn't initialized unless all of them are usable, pending lazy dependencies are
+ * 				brought up first.
+ * 				A stage reached again while its own dependencies are resolved is part of a cycle, the
+ * 				stages of the cycle fail with BOOT_STAGE_DEPENDENCY_FAILED.
+ *
+ * 				Failures are recorded instead of halting. Only a critical stage stops the boot,
+ * 				BootPrintReport() then tells which stage failed and where.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stdint.h>
+#include "xtime_l.h"
+
+/** Definitions **/
+#define BOOT_MAX_STAGES				16
+#define BOOT_INVALID_STAGE			0xFF
+
+// Stage flags
+#define BOOT_STAGE_LAZY				0x01	// Initialized on first use
+#define BOOT_STAGE_TEST_DEFERRABLE 	0x02	// Self-test doesn't disturb a running peripheral
+#define BOOT_STAGE_CRITICAL 		0x04	// A failure stops the boot
+
+// Dependency mask of a stage, e.g. BOOT_DEPENDS_ON(STAGE_GIC) | BOOT_DEPENDS_ON(STAGE_DMA)
+#define BOOT_DEPENDS_ON(stage)		(uint16_t(1) << (stage))
+
+/** Custom Structures **/
+enum BootProfile : uint8_t {
+	BOOT_PROFILE_FULL = 0,
+	BOOT_PROFILE_FAST
+};
+
+enum BootStageStatus : uint8_t {
+	BOOT_STAGE_PENDING = 0,			// Not initialized yet (lazy or boot stopped)
+	BOOT_STAGE_READY,
+	BOOT_STAGE_TEST_DEFERRED,		// Ready, self-test waits for BootRunDeferredSelfTests()
+	BOOT_STAGE_INIT_FAILED,
+	BOOT_STAGE_TEST_FAILED,
+	BOOT_STAGE_DEPENDENCY_FAILED,	// Not initialized, a stage it depends on isn't usable
+	BOOT_STAGE_IN_PROGRESS			// Its dependencies are being resolved
+};
+
+struct BootStage{
+	const char* name;
+	bool 		(*init)();			// Mandatory
+	bool 		(*selfTest)();		// Optional
+	bool 		(*start)();			// Optional
+	uint8_t 	flags;
+	uint16_t 	dependencies;		// Stages which must be usable first, see BOOT_DEPENDS_ON()
+};
+
+struct BootStageRecord{
+	BootStageStatus status;
+	bool 			b_testSkipped;
+	XTime 			initTicks;		// Global timer ticks spent in the initialization
+	XTime 			testTicks;		// Global timer ticks spent in the self-test
+	XTime 			readyAt;		// Global timer value once the stage became usable
+};
+
+/** Function Declarations **/
+bool 					BootRun(const BootStage* stages, uint8_t count, BootProfile profile);	// Returns false if a critical stage fails
+bool 					BootRequire(uint8_t stage);		// Initializes a lazy stage if needed, returns true if it is usable
+bool 					BootRunDeferredSelfTests();		// Returns false if any of them fails
+BootProfile 			BootGetProfile();
+const BootStageRecord& 	BootGetRecord(uint8_t stage);
+void 					BootPrintReport();
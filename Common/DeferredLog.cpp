@@ -0,0 +1,132 @@
+/**
+ * @brief	  	Deferred binary logging
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "DeferredLog.h"
+
+#if defined(__arm__)
+#include "xtime_l.h"
+#endif
+
+/** Function Declarations **/
+extern "C" void outbyte(char c);	// Low level output of the standalone BSP (STDOUT)
+
+/** Global Variables **/
+static DeferredLogRecord 	records[DLOG_BUFFER_SIZE];
+static volatile uint32_t 	head 	= 0;	// Next record to reserve, shared by all producers
+static volatile uint32_t 	tail 	= 0;	// Next record to flush, written by the consumer only
+static volatile uint32_t 	dropped = 0;
+
+uint32_t DeferredLogTimestamp()
+{
+#if defined(__arm__)
+	// Lower half of the global timer, the decoder unwraps it
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	return uint32_t(now);
+#else
+	// No free running timer in the Microblaze designs
+	return 0;
+#endif
+}
+
+bool DeferredLogReserve(DeferredLogRecord*& record)
+{
+	uint32_t slot = __atomic_load_n(&head, __ATOMIC_RELAXED);
+
+	// ISRs can preempt each other and the application, thus the slot is claimed atomically
+	do{
+		if((slot - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) >= DLOG_BUFFER_SIZE)
+		{
+			__atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+
+			return false;
+		}
+	}while(!__atomic_compare_exchange_n(&head, &slot, slot + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+	record = &records[slot & (DLOG_BUFFER_SIZE - 1)];
+
+	return true;
+}
+
+void DeferredLogCommit(DeferredLogRecord* record)
+{
+	__atomic_store_n(&record->b_committed, 1, __ATOMIC_RELEASE);
+}
+
+static void WriteByte(const uint8_t byte, uint8_t& checksum)
+{
+	outbyte(char(byte));
+	checksum += byte;
+}
+
+static void WriteWord(const uint32_t word, uint8_t& checksum)
+{
+	for(uint8_t shift = 0; shift < 32; shift += 8)
+		WriteByte(uint8_t(word >> shift), checksum);
+}
+
+size_t DeferredLogFlush(size_t maxRecords)
+{
+	size_t flushed = 0;
+
+	for(; flushed < maxRecords; ++flushed)
+	{
+		const uint32_t slot = tail;
+
+		if(slot == __atomic_load_n(&head, __ATOMIC_ACQUIRE))
+			break;
+
+		// Reserved but not yet committed, records must go out in order
+		DeferredLogRecord& record = records[slot & (DLOG_BUFFER_SIZE - 1)];
+		if(!__atomic_load_n(&record.b_committed, __ATOMIC_ACQUIRE))
+			break;
+
+		uint8_t checksum = 0;
+		outbyte(char(DLOG_SYNC_BYTE));
+
+		WriteByte(uint8_t(record.formatId), 		checksum);
+		WriteByte(uint8_t(record.formatId >> 8), 	checksum);
+		WriteByte(record.argCount, 					checksum);
+		WriteWord(record.timestamp, 				checksum);
+
+		for(uint8_t idx = 0; (idx < record.argCount) && (idx < DLOG_MAX_ARGS); ++idx)
+			WriteWord(record.args[idx], checksum);
+
+		outbyte(char(checksum));
+
+		// Release the record to the producers
+		record.b_committed = 0;
+		__atomic_store_n(&tail, slot + 1, __ATOMIC_RELEASE);
+	}
+
+	return flushed;
+}
+
+uint32_t DeferredLogDropped()
+{
+	return dropped;
+}
+
+size_t DeferredLogSnapshot(DeferredLogRecord* copies, size_t maxRecords)
+{
+	if(nullptr == copies)
+		return 0;
+
+	// Flushed records stay in the buffer until they are overwritten
+	const uint32_t end 		= __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+	const uint32_t count 	= (end < DLOG_BUFFER_SIZE) ? end : DLOG_BUFFER_SIZE;
+
+	if(maxRecords > count)
+		maxRecords = count;
+
+	// Oldest first
+	for(size_t idx = 0; idx < maxRecords; ++idx)
+		memcpy(&copies[idx], &records[(end - maxRecords + idx) & (DLOG_BUFFER_SIZE - 1)], sizeof(DeferredLogRecord));
+
+	return maxRecords;
+}
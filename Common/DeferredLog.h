@@ -0,0 +1,116 @@
+/**
+ * @brief	  	Deferred binary logging
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		A log call doesn't format anything. It only stores the format ID, a timestamp
+ * 				and the raw arguments into a lock-free record buffer, which takes a few cycles
+ * 				and is safe in ISRs. DeferredLogFlush() streams the records out in binary from
+ * 				a background context (e.g. while the application waits for an event). The
+ * 				DeferredLogDecoder.py script rebuilds the text on the host.
+ *
+ * 				Format strings live only in the source code, they are declared with an X-macro
+ * 				whose entries must be written as FORMAT(NAME, "text"):
+ *
+ * 				#define LOG_FORMATS(FORMAT)							\
+ * 					FORMAT(LOG_BUTTON_PRESSED, "Button pressed!\n")	\
+ * 					FORMAT(LOG_VALUE, "Value: %u\n")
+ *
+ * 				DLOG_DEFINE_FORMATS(LOG_FORMATS)
+ *
+ * 				Arguments are stored as 32-bit words. Integers, floats and characters are
+ * 				supported, strings are not (only their address would be logged).
+ *
+ * 				Frame format (little endian):
+ * 				0xA5 | ID (2) | Argument count (1) | Timestamp (4) | Arguments (4 * n) | Checksum (1)
+ * 				The checksum is the 8-bit sum of the bytes between the sync byte and itself.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+/** Definitions **/
+#ifndef DLOG_BUFFER_SIZE
+#define DLOG_BUFFER_SIZE	64		// Number of records, must be a power of two (override for all sources)
+#endif
+
+#define DLOG_MAX_ARGS		4
+#define DLOG_SYNC_BYTE		0xA5
+
+// Declares the format IDs of an application
+#define DLOG_FORMAT_ID(name, text) 		name,
+#define DLOG_DEFINE_FORMATS(formats) 	enum DeferredLogFormatId : uint16_t { formats(DLOG_FORMAT_ID) DLOG_FORMAT_COUNT };
+
+static_assert(0 == (DLOG_BUFFER_SIZE & (DLOG_BUFFER_SIZE - 1)), "Deferred log buffer size must be a power of two!");
+
+/** Custom Structures **/
+struct DeferredLogRecord{
+	uint32_t 			timestamp;
+	uint16_t 			formatId;
+	uint8_t 			argCount;
+	volatile uint8_t 	b_committed;		// Set by the producer once the record is complete
+	uint32_t 			args[DLOG_MAX_ARGS];
+};
+
+/** Function Declarations **/
+uint32_t 	DeferredLogTimestamp();
+bool 		DeferredLogReserve(DeferredLogRecord*& record);	// Returns false if the buffer is full
+void 		DeferredLogCommit(DeferredLogRecord* record);
+size_t 		DeferredLogFlush(size_t maxRecords = DLOG_BUFFER_SIZE);	// Streams out the committed records
+uint32_t 	DeferredLogDropped();								// Records lost due to a full buffer
+size_t 		DeferredLogSnapshot(DeferredLogRecord* copies, size_t maxRecords);	// Copies the most recent records, flushed or not
+
+/** Argument Packing **/
+// Integers are stored as 32-bit words, 64-bit values are truncated
+template<typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint32_t>::type DeferredLogWord(const T value)
+{
+	return uint32_t(value);
+}
+
+// Floating point values are stored in single precision
+inline uint32_t DeferredLogWord(const float value)
+{
+	uint32_t word = 0;
+	memcpy(&word, &value, sizeof(word));
+
+	return word;
+}
+
+inline uint32_t DeferredLogWord(const double value) { return DeferredLogWord(float(value)); }
+
+inline void DeferredLogPack(uint32_t*) {}
+
+template<typename T, typename... Rest>
+inline void DeferredLogPack(uint32_t* words, const T value, const Rest... rest)
+{
+	*words = DeferredLogWord(value);
+	DeferredLogPack(words + 1, rest...);
+}
+
+/**
+ * @brief	Stores a log record, can be called from any context
+ * @param	formatId	One of the IDs declared with DLOG_DEFINE_FORMATS
+ * @param	args		Arguments of the format string
+ */
+template<typename... Args>
+inline void DeferredLog(const uint16_t formatId, const Args... args)
+{
+	static_assert(sizeof...(Args) <= DLOG_MAX_ARGS, "Too many deferred log arguments!");
+
+	DeferredLogRecord* record = nullptr;
+	if(!DeferredLogReserve(record))
+		return;
+
+	record->timestamp 	= DeferredLogTimestamp();
+	record->formatId 	= formatId;
+	record->argCount 	= sizeof...(Args);
+	DeferredLogPack(record->args, args...);
+
+	DeferredLogCommit(record);
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# Brief     : Host side decoder of the deferred binary log stream (see DeferredLog.h)
+# Author    : Caglayan DOKME, caglayandokme@gmail.com
+# Date      : October 19, 2026
+#           : October 19, 2026 -> Takes a single source file, the IDs are only unique within it
+# Note      : The format strings are extracted from the given source file, the entries of
+#           : the log format X-macro must be written as FORMAT(NAME, "text").
+#           : The IDs are the indexes of the entries in the X-macro of the application, an image
+#           : has a single format list, thus the formats are read from the file declaring it.
+#           : Bytes that don't form a valid frame (e.g. plain printf output) are passed through.
+# Usage     : Decode a captured stream
+#           :   ./DeferredLogDecoder.py -s main.cpp capture.bin
+#           : Decode a live serial port (configure the port with stty beforehand)
+#           :   ./DeferredLogDecoder.py -s main.cpp /dev/ttyACM0
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC_BYTE = 0xA5
+HEADER_SIZE = 7        # ID (2), argument count (1), timestamp (4)
+MAX_ARGS = 4
+
+FORMAT_ENTRY = re.compile(r'FORMAT\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+CONVERSION = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z)?([diouxXcfeEgG%])')
+
+
+def load_formats(path):
+    """Returns the format strings in declaration order (index is the format ID)."""
+    formats = []
+    with open(path, encoding='utf-8', errors='replace') as source:
+        for match in FORMAT_ENTRY.finditer(source.read()):
+            text = match.group(2).encode('utf-8').decode('unicode_escape')
+            formats.append((match.group(1), text))
+
+    # The compiler would reject a repeated enumerator, the file has more than one format list
+    names = [name for name, _ in formats]
+    duplicates = sorted({name for name in names if names.count(name) > 1})
+    if duplicates:
+        raise ValueError('%s declares the formats %s more than once' % (path, ', '.join(duplicates)))
+
+    return formats
+
+
+def render(text, words):
+    """Applies the 32-bit argument words to a printf style format string."""
+    values = []
+    conversions = [c for c in CONVERSION.findall(text) if c != '%']
+    for conversion, word in zip(conversions, words):
+        if conversion in 'di':
+            values.append(struct.unpack('<i', struct.pack('<I', word))[0])
+        elif conversion in 'feEgG':
+            values.append(struct.unpack('<f', struct.pack('<I', word))[0])
+        elif conversion == 'c':
+            values.append(chr(word & 0xFF))
+        else:
+            values.append(word)
+
+    # Python doesn't know the C length modifiers
+    pythonText = CONVERSION.sub(lambda m: m.group(0).replace('hh', '').replace('ll', '')
+                                .replace('h', '').replace('l', '').replace('z', ''), text)
+    try:
+        return pythonText % tuple(values)
+    except (TypeError, ValueError):
+        return '%s %s\n' % (text.rstrip(), words)
+
+
+def decode(stream, formats, tickHz, output):
+    buffer = bytearray()
+    lastTimestamp = 0
+    wraps = 0
+
+    while True:
+        chunk = stream.read(1024)
+        if not chunk:
+            break
+
+        buffer.extend(chunk)
+
+        while buffer:
+            if buffer[0] != SYNC_BYTE:
+                output.write(chr(buffer.pop(0)))
+                continue
+
+            if len(buffer) < 1 + HEADER_SIZE:
+                break
+
+            formatId, argCount, timestamp = struct.unpack_from('<HBI', buffer, 1)
+            frameSize = 1 + HEADER_SIZE + (4 * argCount) + 1
+
+            if argCount > MAX_ARGS or formatId >= len(formats):
+                output.write(chr(buffer.pop(0)))
+                continue
+
+            if len(buffer) < frameSize:
+                break
+
+            if (sum(buffer[1:frameSize - 1]) & 0xFF) != buffer[frameSize - 1]:
+                output.write(chr(buffer.pop(0)))
+                continue
+
+            words = struct.unpack_from('<%dI' % argCount, buffer, 1 + HEADER_SIZE)
+            del buffer[:frameSize]
+
+            # Timestamps are the lower half of the global timer
+            if timestamp < lastTimestamp:
+                wraps += 1
+            lastTimestamp = timestamp
+
+            seconds = ((wraps << 32) + timestamp) / tickHz
+            output.write('[%12.6f] %s' % (seconds, render(formats[formatId][1], words)))
+
+        output.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes the deferred binary log stream.')
+    parser.add_argument('input', help='Captured stream or serial device, "-" for stdin')
+    # The IDs of two applications overlap, a frame would be decoded with the wrong format
+    parser.add_argument('-s', '--source', required=True,
+                        help='Source file declaring the log formats of the application (one file per image)')
+    parser.add_argument('--tick-hz', type=float, default=333333343.5,
+                        help='Frequency of the timestamp counter (default: half of 666.67MHz)')
+    args = parser.parse_args()
+
+    try:
+        formats = load_formats(args.source)
+    except (OSError, ValueError) as error:
+        sys.exit('ERROR: %s' % error)
+
+    if not formats:
+        sys.exit('ERROR: No log formats found in the given source file!')
+
+    if args.input == '-':
+        decode(sys.stdin.buffer, formats, args.tick_hz, sys.stdout)
+    else:
+        with open(args.input, 'rb', buffering=0) as stream:
+            decode(stream, formats, args.tick_hz, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,95 @@
+/**
+ * @brief	  	Typed interrupt vector table on top of the Zynq GIC driver
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Counters placed along with the dispatch path.
+ */
+
+/** Libraries **/
+#include "GicVectorTable.h"
+#include "HotSection.h"
+
+/** Global Variables **/
+// Updated by the trampolines on every interrupt
+HOT_DATA volatile uint32_t gicVectorCounts[GIC_MAX_VECTORS] = {0};
+
+static XScuGic* p_gic = nullptr;
+
+int GicInit(XScuGic* gic, bool b_selfTest)
+{
+	int errCode = XST_SUCCESS;
+
+	if(nullptr == gic)
+		return XST_FAILURE;
+
+	// Find the related configuration
+	XScuGic_Config* config = XScuGic_LookupConfig(XPAR_PS7_SCUGIC_0_DEVICE_ID);
+
+	// Check if the configuration is found
+	if(nullptr == config)
+		return XST_FAILURE;
+
+	// Initialize the driver using the given configuration
+	errCode = XScuGic_CfgInitialize(gic, config, config->CpuBaseAddress);
+	if(XST_SUCCESS != errCode)
+		return errCode;
+
+	if(b_selfTest)
+	{
+		errCode = XScuGic_SelfTest(gic);
+		if(XST_SUCCESS != errCode)
+			return errCode;
+	}
+
+	Xil_ExceptionInit();
+
+	// Connect the IRQ controller handler to the hardware interrupt handling logic
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XScuGic_InterruptHandler), gic);
+
+	p_gic = gic;
+
+	return XST_SUCCESS;
+}
+
+int GicAttach(const GicBinding* bindings, size_t count)
+{
+	if((nullptr == p_gic) || (nullptr == bindings))
+		return XST_FAILURE;
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		const GicBinding& binding = bindings[idx];
+
+		// XScuGic_InterruptHandler calls the trampoline with the bound instance
+		const int errCode = XScuGic_Connect(p_gic, binding.id, binding.trampoline, binding.instance);
+		if(XST_SUCCESS != errCode)
+			return errCode;
+
+		if((GIC_PRIORITY_DEFAULT != binding.priority) || (GIC_TRIGGER_DEFAULT != binding.trigger))
+		{
+			uint8_t priority = 0, trigger = 0;
+			XScuGic_GetPriorityTriggerType(p_gic, binding.id, &priority, &trigger);
+
+			if(GIC_TRIGGER_DEFAULT != binding.trigger)
+				trigger = binding.trigger;
+
+			XScuGic_SetPriorityTriggerType(p_gic, binding.id, binding.priority, trigger);
+		}
+
+		// This only allows the interrupt, the device must be configured to generate it
+		XScuGic_Enable(p_gic, binding.id);
+	}
+
+	return XST_SUCCESS;
+}
+
+void GicStart()
+{
+	// Enable interrupts on the processor
+	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+}
+
+uint32_t GicGetCount(uint32_t id)
+{
+	return (id < GIC_MAX_VECTORS) ? gicVectorCounts[id] : 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @brief	  	Typed interrupt vector table on top of the Zynq GIC driver
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Dispatch path placement noted.
+ *
+ * @note		An application lists its interrupts in a constant table. Each entry binds an
+ * 				interrupt ID to a handler taking the driver instance it serves:
+ *
+ * 				constexpr GicBinding gicBindings[] = {
+ * 					GIC_BIND(XPS_GPIO_INT_ID, 			XGpioPs_IntrHandler, 	&gpio),
+ * 					GIC_BIND(XPAR_PS7_SCUTIMER_0_INTR, 	TimerIrqHandler, 		&timer),
+ * 				};
+ *
+ * 				GIC_BIND instantiates a trampoline for the exact handler and instance type at
+ * 				compile time. XScuGic_InterruptHandler calls the trampoline, which counts the
+ * 				interrupt and calls the handler directly. A handler whose parameter doesn't
+ * 				match the instance fails to compile, no void pointer casts are needed anymore.
+ *
+ * 				The trampolines and the counters are part of the interrupt dispatch path,
+ * 				HotSectionsOcm.ld places them into the OCM along with the vector table and the
+ * 				GIC driver's handler. The trampolines can't be tagged with HOT_CODE, GCC
+ * 				ignores a section attribute on template instances, the linker script matches
+ * 				them by name instead.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xscugic.h"
+#include <stddef.h>
+#include <type_traits>
+
+/** Definitions **/
+#define GIC_MAX_VECTORS 			XSCUGIC_MAX_NUM_INTR_INPUTS
+#define GIC_PRIORITY_DEFAULT 		0xA0	// Same as the BSP default, lower value is higher priority
+#define GIC_TRIGGER_DEFAULT 		0xFF	// Keep the trigger type configured by the BSP
+
+// Binds an interrupt to a handler and the instance passed to it
+#define GIC_BIND(id, handler, instance) 																	\
+	GicBinding{(id), &GicTrampoline<(id), std::remove_pointer<decltype(instance)>::type, decltype(&handler), &handler>,	\
+			   (instance), GIC_PRIORITY_DEFAULT, GIC_TRIGGER_DEFAULT}
+
+// Same as GIC_BIND with an explicit priority and trigger type (1: level sensitive, 3: rising edge)
+#define GIC_BIND_EX(id, handler, instance, priority, trigger) 												\
+	GicBinding{(id), &GicTrampoline<(id), std::remove_pointer<decltype(instance)>::type, decltype(&handler), &handler>,	\
+			   (instance), (priority), (trigger)}
+
+/** Custom Structures **/
+struct GicBinding{
+	uint32_t 				id;
+	Xil_InterruptHandler 	trampoline;
+	void* 					instance;
+	uint8_t 				priority;
+	uint8_t 				trigger;
+};
+
+/** Global Variables **/
+extern volatile uint32_t gicVectorCounts[GIC_MAX_VECTORS];
+
+/** Trampoline **/
+template<uint32_t Id, typename Instance, typename Handler, Handler handler>
+void GicTrampoline(void* instance)
+{
+	static_assert(Id < GIC_MAX_VECTORS, "Invalid interrupt ID!");
+
+	++gicVectorCounts[Id];
+
+	// The instance was bound with this very type by GIC_BIND
+	handler(static_cast<Instance*>(instance));
+}
+
+/** Function Declarations **/
+int 		GicInit(XScuGic* gic, bool b_selfTest = true);				// Driver and exception handler setup
+int 		GicAttach(const GicBinding* bindings, size_t count);		// Connects and enables the given vectors
+void 		GicStart();													// Enables the interrupts on the processor
+uint32_t 	GicGetCount(uint32_t id);
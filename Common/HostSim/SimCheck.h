@@ -0,0 +1,36 @@
+/**
+ * @file 	SimCheck.h
+ * @brief	Checks and the result of the host simulations.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Each check prints a PASS or FAIL line, a single failure fails the simulation. A
+ * 			simulation may also fail itself through SimCheckPassed() when its script can't go
+ * 			on (e.g. nothing would wake the core up) and stops early. main() returns
+ * 			SimCheckResult() as the exit code.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stdio.h>
+
+/** Simulation State **/
+inline bool& SimCheckPassed()
+{
+	static bool b_passed = true;
+
+	return b_passed;
+}
+
+/** Functions **/
+static inline void Check(const char* name, const bool b_condition)
+{
+	printf("  %-48s %s\n", name, b_condition ? "PASS" : "FAIL");
+	SimCheckPassed() &= b_condition;
+}
+
+static inline int SimCheckResult()
+{
+	return SimCheckPassed() ? 0 : 1;
+}
@@ -0,0 +1,296 @@
+/**
+ * @file 	xadcps.h
+ * @brief	Register model of the PS-XADC interface for the host simulations and benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Alarms and interrupts added.
+ * 			October 19, 2026 -> Shared by the host simulations and benchmarks.
+ *
+ * @note	The DRP registers of the XADC are plain memory, the simulation writes the results
+ * 			of the conversions into the status registers with XAdcPsSimSetCode(). The command
+ * 			and read FIFOs behave like the real interface: each word written into the command
+ * 			FIFO pushes the response of the previous command into the read FIFO, which holds
+ * 			15 words. A response that doesn't fit is lost and a read of the empty FIFO returns
+ * 			zero, both are counted. Register offsets, masks and conversion macros are the ones
+ * 			of the BSP.
+ *
+ * 			XAdcPsSimConvert() also compares the result with the alarm thresholds (UG480): a
+ * 			supply alarm is active outside its limits, the temperature and the over-temperature
+ * 			alarms are set above the upper threshold and reset below the lower one. The status
+ * 			bit of an enabled alarm is set at each conversion while it's active and stays set
+ * 			until cleared, XAdcPsSimIrqLine() tells whether the interrupt is asserted.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Definitions **/
+#define XADCPS_CH_TEMP 			0x00
+#define XADCPS_CH_VCCINT 		0x01
+#define XADCPS_CH_VCCAUX 		0x02
+#define XADCPS_CH_VPVN 			0x03
+#define XADCPS_CH_VBRAM 		0x06
+#define XADCPS_CH_VCCPINT 		0x0D
+#define XADCPS_CH_VCCPAUX 		0x0E
+#define XADCPS_CH_VCCPDRO 		0x0F
+
+#define XADCPS_TEMP_OFFSET 			0x00
+#define XADCPS_JTAG_DATA_MASK 		0x0000FFFF
+#define XADCPS_JTAG_ADDR_MASK 		0x03FF0000
+#define XADCPS_JTAG_ADDR_SHIFT 		16
+#define XADCPS_JTAG_CMD_WRITE_MASK 	0x08000000
+#define XADCPS_JTAG_CMD_READ_MASK 	0x04000000
+
+#define XADCPS_CFR1_OFFSET 		0x41
+#define XADCPS_ATR_OFFSET 		0x50	// First alarm threshold register
+
+// Alarm threshold registers, relative to the first one
+#define XADCPS_ATR_TEMP_UPPER 		0x00
+#define XADCPS_ATR_VCCINT_UPPER 	0x01
+#define XADCPS_ATR_VCCAUX_UPPER 	0x02
+#define XADCPS_ATR_OT_UPPER 		0x03
+#define XADCPS_ATR_TEMP_LOWER 		0x04
+#define XADCPS_ATR_VCCINT_LOWER 	0x05
+#define XADCPS_ATR_VCCAUX_LOWER 	0x06
+#define XADCPS_ATR_OT_LOWER 		0x07
+#define XADCPS_ATR_VBRAM_UPPER 		0x08
+#define XADCPS_ATR_VCCPINT_UPPER 	0x09
+#define XADCPS_ATR_VCCPAUX_UPPER 	0x0A
+#define XADCPS_ATR_VCCPDRO_UPPER 	0x0B
+#define XADCPS_ATR_VBRAM_LOWER 		0x0C
+#define XADCPS_ATR_VCCPINT_LOWER 	0x0D
+#define XADCPS_ATR_VCCPAUX_LOWER 	0x0E
+#define XADCPS_ATR_VCCPDRO_LOWER 	0x0F
+
+// Alarm disable bits of the configuration register 1, the enable masks of the driver
+#define XADCPS_CFR1_OT_MASK 			0x0001
+#define XADCPS_CFR1_ALM_TEMP_MASK 		0x0002
+#define XADCPS_CFR1_ALM_VCCINT_MASK 	0x0004
+#define XADCPS_CFR1_ALM_VCCAUX_MASK 	0x0008
+#define XADCPS_CFR1_ALM_VBRAM_MASK 		0x0100
+#define XADCPS_CFR1_ALM_VCCPINT_MASK 	0x0200
+#define XADCPS_CFR1_ALM_VCCPAUX_MASK 	0x0400
+#define XADCPS_CFR1_ALM_VCCPDRO_MASK 	0x0800
+#define XADCPS_CFR1_ALM_ALL_MASK 		0x0F0F
+
+// Interrupt status and mask bits of the PS-XADC interface
+#define XADCPS_INTX_ALM0_MASK 		0x001
+#define XADCPS_INTX_ALM1_MASK 		0x002
+#define XADCPS_INTX_ALM2_MASK 		0x004
+#define XADCPS_INTX_ALM3_MASK 		0x008
+#define XADCPS_INTX_ALM4_MASK 		0x010
+#define XADCPS_INTX_ALM5_MASK 		0x020
+#define XADCPS_INTX_ALM6_MASK 		0x040
+#define XADCPS_INTX_OT_MASK 		0x080
+#define XADCPS_INTX_ALL_MASK 		0x3FF
+
+#define XADCPS_CALIB_SUPPLY_OFFSET_COEFF 	0
+#define XADCPS_CALIB_ADC_OFFSET_COEFF 		1
+#define XADCPS_CALIB_GAIN_ERROR_COEFF 		2
+
+#define XADC_SIM_REGISTERS 		0x80	// DRP address space
+#define XADC_SIM_FIFO_DEPTH 	15
+
+#define XAdcPs_FormatWriteData(RegOffset, Data, ReadWrite) 	\
+	((ReadWrite ? XADCPS_JTAG_CMD_WRITE_MASK : XADCPS_JTAG_CMD_READ_MASK) | (((RegOffset) << XADCPS_JTAG_ADDR_SHIFT) & XADCPS_JTAG_ADDR_MASK) | ((Data) & XADCPS_JTAG_DATA_MASK))
+
+#define XAdcPs_RawToVoltage(AdcData) 		((((float)(AdcData)) * (3.0f)) / 65536.0f)
+#define XAdcPs_VoltageToRaw(Voltage) 		((int)((Voltage) * 65536.0f / 3.0f))
+#define XAdcPs_TemperatureToRaw(Temperature) 	((int)(((Temperature) + 273.15f) * 65536.0f / 503.975f))
+
+// Thresholds of the over-temperature alarm after the power-up
+#define XADC_SIM_OT_UPPER 		XAdcPs_TemperatureToRaw(125.0f)
+#define XADC_SIM_OT_LOWER 		XAdcPs_TemperatureToRaw(70.0f)
+
+/** Custom Structures **/
+struct XAdcPs{
+	u16 	registers[XADC_SIM_REGISTERS];
+	u32 	command;						// Last command, its response is pushed by the next write
+	u32 	readFifo[XADC_SIM_FIFO_DEPTH];
+	u32 	readCount;
+	u32 	readTail;
+	u16 	calibration[3];
+	u32 	intStatus;
+	u32 	intEnabled;						// Complement of the interrupt mask register
+	u32 	activeAlarms;					// XADCPS_INTX_xxx bits of the alarm outputs
+
+	// Statistics of the simulation
+	u32 	commands;						// Words written into the command FIFO
+	u32 	lostResponses;					// Responses pushed into the full read FIFO
+	u32 	emptyReads;						// Reads of the empty read FIFO
+};
+
+/** Simulation State **/
+// Alarm of a channel, the upper and lower threshold registers and the disable bit in CFR1
+struct XAdcPsSimAlarm{
+	u8 		channel;
+	u8 		upper;
+	u8 		lower;
+	u16 	disableMask;
+	u32 	interruptMask;
+	bool 	b_hysteresis;	// Reset below the lower threshold instead of being active below it
+};
+
+static const XAdcPsSimAlarm xadcSimAlarms[] = {
+	{XADCPS_CH_TEMP, 	XADCPS_ATR_TEMP_UPPER, 		XADCPS_ATR_TEMP_LOWER, 		XADCPS_CFR1_ALM_TEMP_MASK, 		XADCPS_INTX_ALM0_MASK, 	true},
+	{XADCPS_CH_VCCINT, 	XADCPS_ATR_VCCINT_UPPER, 	XADCPS_ATR_VCCINT_LOWER, 	XADCPS_CFR1_ALM_VCCINT_MASK, 	XADCPS_INTX_ALM1_MASK, 	false},
+	{XADCPS_CH_VCCAUX, 	XADCPS_ATR_VCCAUX_UPPER, 	XADCPS_ATR_VCCAUX_LOWER, 	XADCPS_CFR1_ALM_VCCAUX_MASK, 	XADCPS_INTX_ALM2_MASK, 	false},
+	{XADCPS_CH_VBRAM, 	XADCPS_ATR_VBRAM_UPPER, 	XADCPS_ATR_VBRAM_LOWER, 	XADCPS_CFR1_ALM_VBRAM_MASK, 	XADCPS_INTX_ALM3_MASK, 	false},
+	{XADCPS_CH_VCCPINT, XADCPS_ATR_VCCPINT_UPPER, 	XADCPS_ATR_VCCPINT_LOWER, 	XADCPS_CFR1_ALM_VCCPINT_MASK, 	XADCPS_INTX_ALM4_MASK, 	false},
+	{XADCPS_CH_VCCPAUX, XADCPS_ATR_VCCPAUX_UPPER, 	XADCPS_ATR_VCCPAUX_LOWER, 	XADCPS_CFR1_ALM_VCCPAUX_MASK, 	XADCPS_INTX_ALM5_MASK, 	false},
+	{XADCPS_CH_VCCPDRO, XADCPS_ATR_VCCPDRO_UPPER, 	XADCPS_ATR_VCCPDRO_LOWER, 	XADCPS_CFR1_ALM_VCCPDRO_MASK, 	XADCPS_INTX_ALM6_MASK, 	false}
+};
+
+// Result of a conversion, a 12-bit code stored MSB justified as the XADC does
+static inline void XAdcPsSimSetCode(XAdcPs* adc, u8 channel, u16 code)
+{
+	adc->registers[XADCPS_TEMP_OFFSET + channel] = u16(code << 4);
+}
+
+static inline bool XAdcPsSimAlarmActive(const bool b_active, const bool b_hysteresis, const u16 value, const u16 upper, const u16 lower)
+{
+	if(b_hysteresis)
+		return b_active ? (value >= lower) : (value > upper);
+
+	return (value > upper) || (value < lower);
+}
+
+// A conversion of the channel, the alarms are updated and latched
+static inline void XAdcPsSimConvert(XAdcPs* adc, u8 channel, u16 code)
+{
+	XAdcPsSimSetCode(adc, channel, code);
+
+	const u16 value 	= adc->registers[XADCPS_TEMP_OFFSET + channel];
+	const u16 disabled 	= adc->registers[XADCPS_CFR1_OFFSET];
+
+	for(const XAdcPsSimAlarm& alarm : xadcSimAlarms)
+	{
+		if(channel != alarm.channel)
+			continue;
+
+		const bool b_active = XAdcPsSimAlarmActive(0 != (adc->activeAlarms & alarm.interruptMask), alarm.b_hysteresis, value,
+												   adc->registers[XADCPS_ATR_OFFSET + alarm.upper], adc->registers[XADCPS_ATR_OFFSET + alarm.lower]);
+
+		adc->activeAlarms = b_active ? (adc->activeAlarms | alarm.interruptMask) : (adc->activeAlarms & ~alarm.interruptMask);
+	}
+
+	// Over-temperature uses the thresholds of the power-up
+	if(XADCPS_CH_TEMP == channel)
+	{
+		const bool b_active = XAdcPsSimAlarmActive(0 != (adc->activeAlarms & XADCPS_INTX_OT_MASK), true, value, XADC_SIM_OT_UPPER, XADC_SIM_OT_LOWER);
+
+		adc->activeAlarms = b_active ? (adc->activeAlarms | XADCPS_INTX_OT_MASK) : (adc->activeAlarms & ~XADCPS_INTX_OT_MASK);
+	}
+
+	// Only the enabled alarms reach the interrupt status
+	u32 enabled = (0 == (disabled & XADCPS_CFR1_OT_MASK)) ? XADCPS_INTX_OT_MASK : 0;
+
+	for(const XAdcPsSimAlarm& alarm : xadcSimAlarms)
+	{
+		if(0 == (disabled & alarm.disableMask))
+			enabled |= alarm.interruptMask;
+	}
+
+	adc->intStatus |= (adc->activeAlarms & enabled);
+}
+
+static inline bool XAdcPsSimIrqLine(const XAdcPs* adc)
+{
+	return 0 != (adc->intStatus & adc->intEnabled);
+}
+
+/** Driver API **/
+static inline void XAdcPs_WriteFifo(XAdcPs* adc, u32 data)
+{
+	const u32 reg 	= ((adc->command & XADCPS_JTAG_ADDR_MASK) >> XADCPS_JTAG_ADDR_SHIFT) & (XADC_SIM_REGISTERS - 1);
+	u32 response 	= 0;
+
+	if(0 != (adc->command & XADCPS_JTAG_CMD_READ_MASK))
+	{
+		response = adc->registers[reg];
+	}
+	else if(0 != (adc->command & XADCPS_JTAG_CMD_WRITE_MASK))
+	{
+		adc->registers[reg] = u16(adc->command & XADCPS_JTAG_DATA_MASK);
+		response 			= adc->registers[reg];
+	}
+
+	if(adc->readCount < XADC_SIM_FIFO_DEPTH)
+		adc->readFifo[(adc->readTail + adc->readCount++) % XADC_SIM_FIFO_DEPTH] = response;
+	else
+		++adc->lostResponses;
+
+	adc->command = data;
+	++adc->commands;
+}
+
+static inline u32 XAdcPs_ReadFifo(XAdcPs* adc)
+{
+	if(0 == adc->readCount)
+	{
+		++adc->emptyReads;
+		return 0;
+	}
+
+	const u32 word = adc->readFifo[adc->readTail];
+
+	adc->readTail = (adc->readTail + 1) % XADC_SIM_FIFO_DEPTH;
+	--adc->readCount;
+
+	return word;
+}
+
+static inline u16 XAdcPs_GetCalibCoefficient(XAdcPs* adc, u8 coefficient)
+{
+	return adc->calibration[coefficient];
+}
+
+// Register accesses over the FIFOs, a dummy command pushes out the response
+static inline u16 XAdcPs_ReadInternalReg(XAdcPs* adc, u32 offset)
+{
+	XAdcPs_WriteFifo(adc, XAdcPs_FormatWriteData(offset, 0x0, false));
+	XAdcPs_WriteFifo(adc, 0x0);
+
+	(void) XAdcPs_ReadFifo(adc);
+
+	return u16(XAdcPs_ReadFifo(adc));
+}
+
+static inline void XAdcPs_WriteInternalReg(XAdcPs* adc, u32 offset, u32 data)
+{
+	XAdcPs_WriteFifo(adc, XAdcPs_FormatWriteData(offset, data, true));
+	XAdcPs_WriteFifo(adc, 0x0);
+
+	(void) XAdcPs_ReadFifo(adc);
+	(void) XAdcPs_ReadFifo(adc);
+}
+
+static inline void XAdcPs_SetAlarmThreshold(XAdcPs* adc, u8 alarmThrReg, u16 value)
+{
+	XAdcPs_WriteInternalReg(adc, XADCPS_ATR_OFFSET + alarmThrReg, value);
+}
+
+static inline u16 XAdcPs_GetAlarmThreshold(XAdcPs* adc, u8 alarmThrReg)
+{
+	return XAdcPs_ReadInternalReg(adc, XADCPS_ATR_OFFSET + alarmThrReg);
+}
+
+// The register holds disable bits, the driver takes the enabled ones
+static inline void XAdcPs_SetAlarmEnables(XAdcPs* adc, u16 almEnableMask)
+{
+	const u16 others = XAdcPs_ReadInternalReg(adc, XADCPS_CFR1_OFFSET) & u16(~XADCPS_CFR1_ALM_ALL_MASK);
+
+	XAdcPs_WriteInternalReg(adc, XADCPS_CFR1_OFFSET, others | (~almEnableMask & XADCPS_CFR1_ALM_ALL_MASK));
+}
+
+static inline u16 XAdcPs_GetAlarmEnables(XAdcPs* adc)
+{
+	return u16(~XAdcPs_ReadInternalReg(adc, XADCPS_CFR1_OFFSET) & XADCPS_CFR1_ALM_ALL_MASK);
+}
+
+static inline void XAdcPs_IntrEnable(XAdcPs* adc, u32 mask) 		{ adc->intEnabled |= (mask & XADCPS_INTX_ALL_MASK); 	}
+static inline void XAdcPs_IntrDisable(XAdcPs* adc, u32 mask) 		{ adc->intEnabled &= ~mask; 							}
+static inline u32 	XAdcPs_IntrGetStatus(XAdcPs* adc) 				{ return adc->intStatus; 								}
+static inline void XAdcPs_IntrClear(XAdcPs* adc, u32 mask) 		{ adc->intStatus &= ~mask; 								}
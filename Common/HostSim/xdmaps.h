@@ -0,0 +1,82 @@
+/**
+ * @file 	xdmaps.h
+ * @brief	Simulated PS DMA controller (PL330) for the host simulations and benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	A transfer is a copy of the buffer descriptor's memory, the done handler of the
+ * 			channel is called right after it as the done interrupt would. The burst settings
+ * 			are checked like the DMA program generator of the BSP does. Addresses are pointer
+ * 			wide here, the BSP's are 32-bit.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+#include <string.h>
+
+/** Definitions **/
+#define XDMAPS_CHANNELS_PER_DEV 	8
+
+/** Custom Structures **/
+struct XDmaPs_ChanCtrl{
+	unsigned int SrcBurstSize;
+	unsigned int SrcBurstLen;
+	unsigned int SrcInc;
+	unsigned int DstBurstSize;
+	unsigned int DstBurstLen;
+	unsigned int DstInc;
+};
+
+struct XDmaPs_BD{
+	UINTPTR 		SrcAddr;
+	UINTPTR 		DstAddr;
+	unsigned int 	Length;
+};
+
+struct XDmaPs_Cmd{
+	XDmaPs_ChanCtrl ChanCtrl;
+	XDmaPs_BD 		BD;
+};
+
+typedef void (*XDmaPsDoneHandler)(unsigned int channel, XDmaPs_Cmd* command, void* arguments);
+
+struct XDmaPs{
+	XDmaPsDoneHandler 	doneHandlers[XDMAPS_CHANNELS_PER_DEV];
+	void* 				doneArguments[XDMAPS_CHANNELS_PER_DEV];
+	u32 				transfers;
+	u64 				bytes;
+};
+
+/** Driver API **/
+static inline int XDmaPs_SetDoneHandler(XDmaPs* dma, unsigned int channel, XDmaPsDoneHandler handler, void* arguments)
+{
+	if(channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	dma->doneHandlers[channel] 	= handler;
+	dma->doneArguments[channel] = arguments;
+
+	return XST_SUCCESS;
+}
+
+static inline int XDmaPs_Start(XDmaPs* dma, unsigned int channel, XDmaPs_Cmd* command, int holdDmaProg)
+{
+	const XDmaPs_ChanCtrl& control = command->ChanCtrl;
+
+	// Burst sizes are 1 to 8 bytes (powers of two), burst lengths 1 to 16 beats
+	if((channel >= XDMAPS_CHANNELS_PER_DEV) || (0 == control.SrcBurstSize) || (control.SrcBurstSize > 8) ||
+	   (0 != (control.SrcBurstSize & (control.SrcBurstSize - 1))) || (0 == control.SrcBurstLen) || (control.SrcBurstLen > 16))
+		return XST_FAILURE;
+
+	memcpy(reinterpret_cast<void*>(command->BD.DstAddr), reinterpret_cast<const void*>(command->BD.SrcAddr), command->BD.Length);
+
+	++dma->transfers;
+	dma->bytes += command->BD.Length;
+
+	if(nullptr != dma->doneHandlers[channel])
+		dma->doneHandlers[channel](channel, command, dma->doneArguments[channel]);
+
+	return XST_SUCCESS;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file 	xgpiops.h
+ * @brief	Simulated PS GPIO for the host benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Only the pin accesses of the ZynqPsGpio example are provided. The pins of a bank
+ * 			are a volatile word, thus each read is an access the compiler can't drop.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Custom Structures **/
+struct XGpioPs{
+	volatile u32 pins;		// Bank 0, a bit per pin
+};
+
+/** Driver API **/
+static inline u32 XGpioPs_ReadPin(XGpioPs* gpio, u32 pin)
+{
+	return (gpio->pins >> pin) & 1;
+}
+
+static inline void XGpioPs_WritePin(XGpioPs* gpio, u32 pin, u32 data)
+{
+	gpio->pins = (gpio->pins & ~(1u << pin)) | ((data & 1) << pin);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file 	xil_exception.h
+ * @brief	Simulated IRQ mask of the core for the host simulations.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Shared by all host simulations.
+ *
+ * @note	The simulation connects the interrupt controller with irqHandler. An edge raised
+ * 			with ExceptionSimRaise() stays pending until it's taken, a level sensitive source
+ * 			is asserted as long as irqLine tells so. ExceptionSimServe() takes the interrupt if
+ * 			the IRQs are unmasked, Xil_ExceptionEnableMask() takes the one that arrived while
+ * 			they were masked, as the core does.
+ */
+
+#pragma once
+
+/** Definitions **/
+#define XIL_EXCEPTION_IRQ 	0x80
+
+/** Custom Structures **/
+struct ExceptionSim{
+	bool 	b_irqMasked;
+	bool 	b_irqPending;		// Raised by ExceptionSimRaise()
+	bool 	(*irqLine)();		// Optional, tells whether a level sensitive interrupt is asserted
+	void 	(*irqHandler)();	// Stands for the dispatch of the interrupt controller
+	unsigned irqCount;
+};
+
+/** Simulation State **/
+inline ExceptionSim& ExceptionSimState()
+{
+	static ExceptionSim state = {false, false, nullptr, nullptr, 0};
+
+	return state;
+}
+
+static inline void ExceptionSimServe()
+{
+	ExceptionSim& state = ExceptionSimState();
+
+	if(state.b_irqMasked || (nullptr == state.irqHandler))
+		return;
+
+	if(state.b_irqPending || ((nullptr != state.irqLine) && state.irqLine()))
+	{
+		state.b_irqPending = false;
+		++state.irqCount;
+		state.irqHandler();
+	}
+}
+
+static inline void ExceptionSimRaise()
+{
+	ExceptionSimState().b_irqPending = true;
+	ExceptionSimServe();
+}
+
+/** Driver API **/
+static inline void Xil_ExceptionDisableMask(unsigned mask)
+{
+	if(0 != (mask & XIL_EXCEPTION_IRQ))
+		ExceptionSimState().b_irqMasked = true;
+}
+
+static inline void Xil_ExceptionEnableMask(unsigned mask)
+{
+	if(0 != (mask & XIL_EXCEPTION_IRQ))
+	{
+		ExceptionSimState().b_irqMasked = false;
+		ExceptionSimServe();
+	}
+}
+
+static inline void Xil_ExceptionDisable() 	{ Xil_ExceptionDisableMask(XIL_EXCEPTION_IRQ); 	}
+static inline void Xil_ExceptionEnable() 	{ Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ); 	}
@@ -0,0 +1,23 @@
+/**
+ * @file 	xil_types.h
+ * @brief	Basic types of the standalone BSP for the host simulations and benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+#define XST_SUCCESS 	0L
+#define XST_FAILURE 	1L
+
+typedef uint8_t 	u8;
+typedef uint16_t 	u16;
+typedef uint32_t 	u32;
+typedef uint64_t 	u64;
+typedef int32_t 	s32;
+typedef uintptr_t 	UINTPTR;
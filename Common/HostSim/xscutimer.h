@@ -0,0 +1,60 @@
+/**
+ * @file 	xscutimer.h
+ * @brief	Simulated private timer of the Cortex-A9 for the host simulations and benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Shared by the host simulations and benchmarks.
+ *
+ * @note	Only the part of the XScuTimer API used by the idle manager and the XADC acquisition
+ * 			is provided. The timer counts down from the loaded value at the rate of the global
+ * 			timer, the simulation asks for the expiry with ScuTimerSimExpiry() and raises the
+ * 			interrupt status with ScuTimerSimExpire(). The acquisition benchmark calls the
+ * 			handler in place of the timer interrupt.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+#include "xtime_l.h"
+
+/** Custom Structures **/
+struct XScuTimer{
+	u32 	load;
+	bool 	b_running;
+	bool 	b_autoReload;
+	bool 	b_interruptEnabled;
+	u32 	interruptStatus;
+	XTime 	startTime;
+	u32 	starts;
+};
+
+/** Driver API **/
+static inline void XScuTimer_LoadTimer(XScuTimer* timer, u32 value) 	{ timer->load = value; 					}
+static inline void XScuTimer_DisableAutoReload(XScuTimer* timer) 		{ timer->b_autoReload = false; 			}
+static inline void XScuTimer_EnableInterrupt(XScuTimer* timer) 			{ timer->b_interruptEnabled = true; 	}
+static inline void XScuTimer_ClearInterruptStatus(XScuTimer* timer) 	{ timer->interruptStatus = 0; 			}
+static inline void XScuTimer_Stop(XScuTimer* timer) 					{ timer->b_running = false; 			}
+
+static inline void XScuTimer_Start(XScuTimer* timer)
+{
+	timer->b_running 	= true;
+	timer->startTime 	= GlobalTimerSimNow();
+	++timer->starts;
+}
+
+/** Simulation **/
+// Global timer value at which the running timer reaches zero
+static inline XTime ScuTimerSimExpiry(const XScuTimer* timer)
+{
+	return timer->startTime + timer->load;
+}
+
+// Counter reached zero, a one-shot timer stops
+static inline void ScuTimerSimExpire(XScuTimer* timer)
+{
+	timer->interruptStatus = 1;
+
+	if(!timer->b_autoReload)
+		timer->b_running = false;
+}
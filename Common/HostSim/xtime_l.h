@@ -0,0 +1,41 @@
+/**
+ * @file 	xtime_l.h
+ * @brief	Simulated global timer for the host simulations and benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Shared by all host simulations and benchmarks.
+ *
+ * @note	The time only moves when the simulation moves it with GlobalTimerSimAdvance(). A
+ * 			tick is two CPU clocks as on the Zedboard, the rate of the SCU timers too. The
+ * 			benchmarks don't move it, reading the timer costs a load as the register read does
+ * 			on the board.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Definitions **/
+#define COUNTS_PER_SECOND 	333333343ULL	// Half of the 666.67MHz CPU clock
+
+typedef u64 XTime;
+
+/** Simulation State **/
+inline XTime& GlobalTimerSimNow()
+{
+	static XTime now = 0;
+
+	return now;
+}
+
+inline void GlobalTimerSimAdvance(const XTime ticks)
+{
+	GlobalTimerSimNow() += ticks;
+}
+
+/** Driver API **/
+static inline void XTime_GetTime(XTime* time)
+{
+	*time = GlobalTimerSimNow();
+}
@@ -0,0 +1,188 @@
+/**
+ * @file 	xttcps.h
+ * @brief	Simulated triple timer counter for the host benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The registers of each timer are plain memory, the driver functions access them as
+ * 			the BSP does: the initialization writes the reset values, the self-test checks
+ * 			them, the options and the prescaler are translated into the control registers.
+ * 			The interval calculation is the one of the BSP. Nothing counts, the setup path
+ * 			is what the benchmark measures.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Definitions **/
+#define XTTCPS_NUM_DEVICES 				6			// Three timers in each of the two TTCs
+#define XTTCPS_INPUT_CLOCK_HZ 			111111115	// CPU_1x clock of the Zedboard
+
+#define XTTCPS_OPTION_EXTERNAL_CLK 		0x0001
+#define XTTCPS_OPTION_CLK_EDGE_NEG 		0x0002
+#define XTTCPS_OPTION_INTERVAL_MODE 	0x0004
+#define XTTCPS_OPTION_DECREMENT 		0x0008
+#define XTTCPS_OPTION_MATCH_MODE 		0x0010
+#define XTTCPS_OPTION_WAVE_DISABLE 		0x0020
+#define XTTCPS_OPTION_WAVE_POLARITY 	0x0040
+
+#define XTTCPS_IXR_INTERVAL_MASK 		0x01
+#define XTTCPS_IXR_ALL_MASK 			0x3F
+
+#define XTTCPS_MAX_INTERVAL_COUNT 		0xFFFF
+#define XTTCPS_CLK_CNTRL_PS_DISABLE 	16
+
+// Bits of the control registers
+#define XTTCPS_CLK_CNTRL_PS_EN_MASK 	0x01
+#define XTTCPS_CLK_CNTRL_PS_VAL_SHIFT 	1
+#define XTTCPS_CLK_CNTRL_PS_VAL_MASK 	0x1E
+#define XTTCPS_CNT_CNTRL_DIS_MASK 		0x01
+#define XTTCPS_CNT_CNTRL_INT_MASK 		0x02
+#define XTTCPS_CNT_CNTRL_DECR_MASK 		0x04
+#define XTTCPS_CNT_CNTRL_MATCH_MASK 	0x08
+#define XTTCPS_CNT_CNTRL_EN_WAVE_MASK 	0x20	// Active low
+#define XTTCPS_CNT_CNTRL_POL_WAVE_MASK 	0x40
+#define XTTCPS_CNT_CNTRL_RESET_VALUE 	0x21
+
+typedef u16 XInterval;
+
+/** Custom Structures **/
+struct XTtcPs_Config{
+	u16 	DeviceId;
+	UINTPTR BaseAddress;
+	u32 	InputClockHz;
+};
+
+struct XTtcPs{
+	XTtcPs_Config 	Config;
+	u32 			IsReady;
+};
+
+// Registers of a single timer
+struct XTtcPsRegisters{
+	u32 clockControl;
+	u32 counterControl;
+	u32 interval;
+	u32 match[3];
+	u32 interruptStatus;
+	u32 interruptEnable;
+};
+
+/** Simulation State **/
+// Not static, so that all the translation units share the same timers
+inline XTtcPsRegisters* XTtcPsSimRegisters(const XTtcPs* timer)
+{
+	return reinterpret_cast<XTtcPsRegisters*>(timer->Config.BaseAddress);
+}
+
+inline XTtcPs_Config* XTtcPs_LookupConfig(u16 deviceId)
+{
+	static XTtcPsRegisters 	registers[XTTCPS_NUM_DEVICES];
+	static XTtcPs_Config 	configs[XTTCPS_NUM_DEVICES];
+
+	if(deviceId >= XTTCPS_NUM_DEVICES)
+		return nullptr;
+
+	configs[deviceId] = XTtcPs_Config{deviceId, UINTPTR(&registers[deviceId]), XTTCPS_INPUT_CLOCK_HZ};
+
+	return &configs[deviceId];
+}
+
+/** Driver API **/
+static inline s32 XTtcPs_CfgInitialize(XTtcPs* timer, XTtcPs_Config* config, UINTPTR baseAddress)
+{
+	timer->Config 				= *config;
+	timer->Config.BaseAddress 	= baseAddress;
+
+	// Stopped and reset, as after the power-up
+	XTtcPsRegisters* const registers = XTtcPsSimRegisters(timer);
+	*registers 					= XTtcPsRegisters{};
+	registers->counterControl 	= XTTCPS_CNT_CNTRL_RESET_VALUE;
+
+	timer->IsReady = 1;
+
+	return XST_SUCCESS;
+}
+
+static inline s32 XTtcPs_SelfTest(XTtcPs* timer)
+{
+	return (XTTCPS_CNT_CNTRL_RESET_VALUE == XTtcPsSimRegisters(timer)->counterControl) ? XST_SUCCESS : XST_FAILURE;
+}
+
+static inline s32 XTtcPs_SetOptions(XTtcPs* timer, u32 options)
+{
+	XTtcPsRegisters* const registers = XTtcPsSimRegisters(timer);
+	u32 control = registers->counterControl & ~u32(XTTCPS_CNT_CNTRL_INT_MASK | XTTCPS_CNT_CNTRL_DECR_MASK |
+				  XTTCPS_CNT_CNTRL_MATCH_MASK | XTTCPS_CNT_CNTRL_EN_WAVE_MASK | XTTCPS_CNT_CNTRL_POL_WAVE_MASK);
+
+	if(0 != (options & XTTCPS_OPTION_INTERVAL_MODE)) 	control |= XTTCPS_CNT_CNTRL_INT_MASK;
+	if(0 != (options & XTTCPS_OPTION_DECREMENT)) 		control |= XTTCPS_CNT_CNTRL_DECR_MASK;
+	if(0 != (options & XTTCPS_OPTION_MATCH_MODE)) 		control |= XTTCPS_CNT_CNTRL_MATCH_MASK;
+	if(0 != (options & XTTCPS_OPTION_WAVE_DISABLE)) 	control |= XTTCPS_CNT_CNTRL_EN_WAVE_MASK;
+	if(0 != (options & XTTCPS_OPTION_WAVE_POLARITY)) 	control |= XTTCPS_CNT_CNTRL_POL_WAVE_MASK;
+
+	registers->counterControl = control;
+
+	return XST_SUCCESS;
+}
+
+static inline void XTtcPs_CalcIntervalFromFreq(XTtcPs* timer, u32 frequency, XInterval* interval, u8* prescaler)
+{
+	const u32 inputClock = timer->Config.InputClockHz;
+	u32 counts = inputClock / frequency;
+
+	// Too close to the input clock
+	if(counts < 4)
+	{
+		*interval 	= XTTCPS_MAX_INTERVAL_COUNT;
+		*prescaler 	= 0xFF;
+		return;
+	}
+
+	if(counts < 65536)
+	{
+		*interval 	= XInterval(counts);
+		*prescaler 	= XTTCPS_CLK_CNTRL_PS_DISABLE;
+		return;
+	}
+
+	// The smallest prescaler gives the finest resolution
+	for(u8 candidate = 0; candidate < XTTCPS_CLK_CNTRL_PS_DISABLE; ++candidate)
+	{
+		counts = inputClock / (frequency * (u32(1) << (candidate + 1)));
+
+		if(counts < 65536)
+		{
+			*interval 	= XInterval(counts);
+			*prescaler 	= candidate;
+			return;
+		}
+	}
+
+	*interval 	= XTTCPS_MAX_INTERVAL_COUNT;
+	*prescaler 	= 0xFF;
+}
+
+static inline void XTtcPs_SetInterval(XTtcPs* timer, XInterval value) 	{ XTtcPsSimRegisters(timer)->interval = value; }
+
+static inline void XTtcPs_SetPrescaler(XTtcPs* timer, u8 prescaler)
+{
+	XTtcPsRegisters* const registers = XTtcPsSimRegisters(timer);
+	u32 control = registers->clockControl & ~u32(XTTCPS_CLK_CNTRL_PS_EN_MASK | XTTCPS_CLK_CNTRL_PS_VAL_MASK);
+
+	if(prescaler < XTTCPS_CLK_CNTRL_PS_DISABLE)
+		control |= XTTCPS_CLK_CNTRL_PS_EN_MASK | (u32(prescaler) << XTTCPS_CLK_CNTRL_PS_VAL_SHIFT);
+
+	registers->clockControl = control;
+}
+
+static inline void 		XTtcPs_SetMatchValue(XTtcPs* timer, u8 index, XInterval value) 	{ XTtcPsSimRegisters(timer)->match[index] = value; 				}
+static inline XInterval XTtcPs_GetMatchValue(XTtcPs* timer, u8 index) 					{ return XInterval(XTtcPsSimRegisters(timer)->match[index]); 	}
+static inline void 		XTtcPs_EnableInterrupts(XTtcPs* timer, u32 mask) 				{ XTtcPsSimRegisters(timer)->interruptEnable |= mask; 			}
+static inline void 		XTtcPs_DisableInterrupts(XTtcPs* timer, u32 mask) 				{ XTtcPsSimRegisters(timer)->interruptEnable &= ~mask; 			}
+static inline u32 		XTtcPs_GetInterruptStatus(XTtcPs* timer) 						{ return XTtcPsSimRegisters(timer)->interruptStatus; 			}
+static inline void 		XTtcPs_ClearInterruptStatus(XTtcPs* timer, u32 mask) 			{ XTtcPsSimRegisters(timer)->interruptStatus &= ~mask; 			}
+static inline void 		XTtcPs_Start(XTtcPs* timer) 									{ XTtcPsSimRegisters(timer)->counterControl &= ~u32(XTTCPS_CNT_CNTRL_DIS_MASK); }
+static inline void 		XTtcPs_Stop(XTtcPs* timer) 										{ XTtcPsSimRegisters(timer)->counterControl |= XTTCPS_CNT_CNTRL_DIS_MASK; }
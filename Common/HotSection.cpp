@@ -0,0 +1,83 @@
+/**
+ * @brief	  	Placement of the hot code and data into the on-chip memory
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "HotSection.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define HOT_RANGE_COUNT 	2
+
+/** Custom Structures **/
+struct HotRange{
+	const char* name;
+	uintptr_t 	start;
+	uintptr_t 	end;
+};
+
+/** Linker Script Symbols **/
+// Weak, so that their addresses are zero if the linker script doesn't place the sections
+extern "C" uint8_t __hot_text_start __attribute__((weak));
+extern "C" uint8_t __hot_text_end 	__attribute__((weak));
+extern "C" uint8_t __hot_data_start __attribute__((weak));
+extern "C" uint8_t __hot_data_end 	__attribute__((weak));
+
+static HotRange GetRange(const uint8_t index)
+{
+	if(0 == index)
+		return HotRange{".hot_text", reinterpret_cast<uintptr_t>(&__hot_text_start), reinterpret_cast<uintptr_t>(&__hot_text_end)};
+
+	return HotRange{".hot_data", reinterpret_cast<uintptr_t>(&__hot_data_start), reinterpret_cast<uintptr_t>(&__hot_data_end)};
+}
+
+/**
+ * @return	Index of the section containing the address, HOT_RANGE_COUNT if none
+ */
+static uint8_t Locate(const uintptr_t address)
+{
+	for(uint8_t idx = 0; idx < HOT_RANGE_COUNT; ++idx)
+	{
+		const HotRange range = GetRange(idx);
+
+		if((address >= range.start) && (address < range.end))
+			return idx;
+	}
+
+	return HOT_RANGE_COUNT;
+}
+
+void* HotSectionEnd()
+{
+	return (nullptr == &__hot_data_end) ? nullptr : &__hot_data_end;
+}
+
+bool HotIsPlaced(const volatile void* address)
+{
+	return HOT_RANGE_COUNT != Locate(reinterpret_cast<uintptr_t>(address));
+}
+
+void HotPrintReport(const HotSymbol* symbols, size_t count)
+{
+	printf("Hot placement:\n");
+
+	for(uint8_t idx = 0; idx < HOT_RANGE_COUNT; ++idx)
+	{
+		const HotRange range = GetRange(idx);
+
+		if(0 == range.start)
+			printf("  %-24s not placed, the linker script has no hot sections\n", range.name);
+		else
+			printf("  %-24s 0x%08X - 0x%08X %6u bytes\n", range.name, unsigned(range.start), unsigned(range.end), unsigned(range.end - range.start));
+	}
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		const uintptr_t address = reinterpret_cast<uintptr_t>(symbols[idx].address);
+		const uint8_t 	range 	= Locate(address);
+
+		printf("  %-24s 0x%08X %s\n", symbols[idx].name, unsigned(address), (HOT_RANGE_COUNT == range) ? "elsewhere" : GetRange(range).name);
+	}
+}
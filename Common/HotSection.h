@@ -0,0 +1,47 @@
+/**
+ * @brief	  	Placement of the hot code and data into the on-chip memory
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Interrupt dispatch path placement noted.
+ *
+ * @note		Tagged functions and variables are collected into the .hot_text and .hot_data
+ * 				sections. The linker script maps them into the lowest latency memory:
+ * 				- Microblaze: LMB BRAM, see MicroblazeDDR/SwProject/lscript.ld
+ * 				- Zynq: High OCM, add "INCLUDE HotSectionsOcm.ld" into the SECTIONS block of
+ * 				  the lscript.ld generated by the SDK and add Common to the library search path
+ * 				  (see ZynqTripleTimerCounter/SwProject/lscript.ld). It also places the interrupt
+ * 				  dispatch path of the BSP and the GIC_BIND trampolines, which can't be tagged.
+ *
+ * 				Without the linker script support, the sections are placed along with the
+ * 				rest of the application, nothing breaks but nothing is gained either.
+ *
+ * 				On the Zynq, a branch from the OCM to the DDR is out of the range of a BL
+ * 				instruction. The linker inserts a long branch veneer for such calls.
+ *
+ * 				Keep the tagged set small, the LMB BRAM is only 4KB and shared with the
+ * 				fast memory arena.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+#define HOT_CODE 			__attribute__((section(".hot_text")))
+#define HOT_DATA 			__attribute__((section(".hot_data")))
+
+// Lists a function or variable in the placement report
+#define HOT_SYMBOL(symbol) 	HotSymbol{#symbol, reinterpret_cast<const volatile void*>(&(symbol))}
+
+/** Custom Structures **/
+struct HotSymbol{
+	const char* 			name;
+	const volatile void* 	address;
+};
+
+/** Function Declarations **/
+void* 	HotSectionEnd();										// First free byte after the hot sections, nullptr if they aren't placed
+bool 	HotIsPlaced(const volatile void* address);				// Address is in one of the hot sections
+void 	HotPrintReport(const HotSymbol* symbols, size_t count);	// Sections and the location of the given symbols
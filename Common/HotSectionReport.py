@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Brief     : Lists what landed in the hot sections (see HotSection.h) using a linker map file
+# Author    : Caglayan DOKME, caglayandokme@gmail.com
+# Date      : October 19, 2026
+# Note      : Generate the map file with the -Wl,-Map=<file> linker flag. The size of a symbol
+#           : is the distance to the next symbol or to the end of its input section.
+# Usage     : ./HotSectionReport.py Debug/App.map
+#           : ./HotSectionReport.py -s .hot_text -s .text Debug/App.map
+
+import argparse
+import re
+import sys
+
+OUTPUT_SECTION = re.compile(r'^(\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)')
+INPUT_SECTION = re.compile(r'^ (\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+WRAPPED_NAME = re.compile(r'^ ?(\.\S+)$')
+WRAPPED_REST = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*))?$')
+SYMBOL = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_$][\w$.]*)\s*$')
+
+
+def read_lines(path):
+    """Returns the memory map part of the file with the wrapped long section names joined."""
+    with open(path, encoding='utf-8', errors='replace') as mapFile:
+        lines = mapFile.read().splitlines()
+
+    try:
+        lines = lines[lines.index('Linker script and memory map') + 1:]
+    except ValueError:
+        pass
+
+    joined = []
+    idx = 0
+    while idx < len(lines):
+        line = lines[idx]
+        name = WRAPPED_NAME.match(line)
+        if name and (idx + 1) < len(lines) and WRAPPED_REST.match(lines[idx + 1]):
+            # The linker moves the rest of a long section name to the next line
+            line = line + ' ' + lines[idx + 1].strip()
+            idx += 1
+
+        joined.append(line)
+        idx += 1
+
+    return joined
+
+
+def parse(lines, sectionNames):
+    """Returns {output section: (address, size, [(input section, object, address, size, [(symbol, address)])])}."""
+    sections = {}
+    current = None
+
+    for line in lines:
+        output = OUTPUT_SECTION.match(line)
+        if output:
+            current = None
+            if output.group(1) in sectionNames:
+                current = (int(output.group(2), 16), int(output.group(3), 16), [])
+                sections[output.group(1)] = current
+            continue
+
+        if current is None:
+            continue
+
+        inputSection = INPUT_SECTION.match(line)
+        if inputSection:
+            current[2].append((inputSection.group(1), inputSection.group(4).strip(),
+                               int(inputSection.group(2), 16), int(inputSection.group(3), 16), []))
+            continue
+
+        symbol = SYMBOL.match(line)
+        if symbol and current[2] and '=' not in line:
+            current[2][-1][4].append((symbol.group(2), int(symbol.group(1), 16)))
+
+    return sections
+
+
+def report(sections, sectionNames, output):
+    for name in sectionNames:
+        if name not in sections:
+            output.write('%s: not in the map file\n' % name)
+            continue
+
+        address, size, inputs = sections[name]
+        output.write('%s: 0x%08X, %u bytes\n' % (name, address, size))
+
+        for _, objectFile, inputAddress, inputSize, symbols in inputs:
+            if 0 == inputSize:
+                continue
+
+            output.write('  %-40s 0x%08X %6u bytes\n' % (objectFile, inputAddress, inputSize))
+
+            symbols = sorted(symbols, key=lambda entry: entry[1])
+            for idx, (symbol, symbolAddress) in enumerate(symbols):
+                end = symbols[idx + 1][1] if (idx + 1) < len(symbols) else (inputAddress + inputSize)
+                output.write('    %-38s 0x%08X %6u bytes\n' % (symbol, symbolAddress, end - symbolAddress))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Lists the contents of the hot sections using a linker map file.')
+    parser.add_argument('map', help='Linker map file')
+    parser.add_argument('-s', '--section', action='append', dest='sections',
+                        help='Output section to list, can be repeated (default: .hot_text and .hot_data)')
+    arguments = parser.parse_args()
+
+    sectionNames = arguments.sections or ['.hot_text', '.hot_data']
+    report(parse(read_lines(arguments.map), sectionNames), sectionNames, sys.stdout)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
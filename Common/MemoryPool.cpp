@@ -0,0 +1,115 @@
+/**
+ * @brief	  	Memory region aware allocation, fixed size object pools and bump arenas
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "MemoryPool.h"
+#include <stdio.h>
+
+/** Custom Structures **/
+struct MemoryEntry{
+	const char* 				name;
+	const MemoryStatistics* 	statistics;
+	const char* 				unit;
+};
+
+/** Global Variables **/
+Arena memoryFast;
+Arena memoryBulk;
+
+static MemoryEntry 	entries[MEMORY_MAX_ENTRIES];
+static uint8_t 		entryCount = 0;
+
+void Arena::Init(const char* name, void* base, size_t size)
+{
+	m_name 		= name;
+	m_base 		= reinterpret_cast<uintptr_t>(base);
+
+	m_statistics = MemoryStatistics{};
+	m_statistics.capacity = size;
+
+	MemoryRegister(name, &m_statistics, "bytes");
+}
+
+void* Arena::Allocate(size_t size, size_t alignment)
+{
+	// Alignment must be a power of two
+	if((0 == size) || (0 == alignment) || (0 != (alignment & (alignment - 1))))
+		return nullptr;
+
+	MemoryLock lock;
+
+	const uintptr_t current = m_base + m_statistics.used;
+	const uintptr_t aligned = (current + alignment - 1) & ~uintptr_t(alignment - 1);
+	const size_t 	newUsed = (aligned - m_base) + size;
+
+	if((newUsed > m_statistics.capacity) || (newUsed < m_statistics.used))
+	{
+		++m_statistics.failures;
+		return nullptr;
+	}
+
+	m_statistics.used = newUsed;
+
+	if(newUsed > m_statistics.highWater)
+		m_statistics.highWater = newUsed;
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+size_t Arena::Mark() const
+{
+	return m_statistics.used;
+}
+
+void Arena::Release(size_t mark)
+{
+	MemoryLock lock;
+
+	// Only the space above the current level can be given back
+	if(mark < m_statistics.used)
+		m_statistics.used = mark;
+}
+
+size_t Arena::Available() const
+{
+	return m_statistics.capacity - m_statistics.used;
+}
+
+void MemoryRegister(const char* name, const MemoryStatistics* statistics, const char* unit)
+{
+	// Re-initialized entries keep their place
+	for(uint8_t idx = 0; idx < entryCount; ++idx)
+	{
+		if(statistics == entries[idx].statistics)
+		{
+			entries[idx].name = name;
+			entries[idx].unit = unit;
+			return;
+		}
+	}
+
+	if(entryCount < MEMORY_MAX_ENTRIES)
+		entries[entryCount++] = MemoryEntry{name, statistics, unit};
+}
+
+void MemoryPrintReport()
+{
+	printf("Memory usage:\n");
+
+	for(uint8_t idx = 0; idx < entryCount; ++idx)
+	{
+		const MemoryEntry& entry 			= entries[idx];
+		const MemoryStatistics& statistics 	= *entry.statistics;
+
+		printf("  %-12s %8u / %8u %-7s high water %8u, failures %u\n",
+				entry.name,
+				unsigned(statistics.used),
+				unsigned(statistics.capacity),
+				entry.unit,
+				unsigned(statistics.highWater),
+				unsigned(statistics.failures));
+	}
+}
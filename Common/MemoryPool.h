@@ -0,0 +1,263 @@
+/**
+ * @brief	  	Memory region aware allocation, fixed size object pools and bump arenas
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Pools reject a slot that is freed twice.
+ *
+ * @note		An arena hands out memory from a single region by moving a pointer forward,
+ * 				it is meant for large buffers that live until a reset or a Release(). Two
+ * 				arenas are provided, the application initializes them with its memory map:
+ * 				- memoryFast: On-chip memory (LMB BRAM of the Microblaze, OCM of the Zynq)
+ * 				- memoryBulk: DDR
+ *
+ * 				A pool carves the storage of N objects from an arena once and then allocates
+ * 				and frees them in constant time through a free list kept in the unused slots.
+ * 				A bit per slot tells whether it is in the free list, freeing an object twice
+ * 				is rejected instead of linking the slot twice and handing it out twice.
+ * 				Pools placed in the fast arena keep the hot structures in the lowest latency
+ * 				memory. Both are safe to use from an ISR, the interrupts of the core are masked
+ * 				for a few instructions while the lists are updated.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+/** Definitions **/
+#define MEMORY_MAX_ENTRIES 		12				// Arenas and pools listed in the report
+#define MEMORY_ALIGNMENT 		sizeof(uint64_t)
+
+/** Custom Structures **/
+struct MemoryStatistics{
+	size_t 		capacity 	= 0;	// Bytes for arenas, objects for pools
+	size_t 		used 		= 0;
+	size_t 		highWater 	= 0;
+	uint32_t 	failures 	= 0;	// Requests that couldn't be satisfied
+};
+
+/**
+ * @brief	Masks the interrupts of the core until destructed, the previous state is restored
+ */
+class MemoryLock{
+public:
+	MemoryLock()
+	{
+#if defined(__arm__)
+		asm volatile("mrs %0, cpsr	\n"
+					 "cpsid i		\n" : "=r"(m_state) : : "memory");
+#elif defined(__MICROBLAZE__)
+		asm volatile("mfs %0, rmsr" : "=r"(m_state));
+		asm volatile("mts rmsr, %0" : : "r"(m_state & ~MSR_IE) : "memory");
+#endif
+	}
+
+	~MemoryLock()
+	{
+#if defined(__arm__)
+		asm volatile("msr cpsr_c, %0" : : "r"(m_state) : "memory");
+#elif defined(__MICROBLAZE__)
+		asm volatile("mts rmsr, %0" : : "r"(m_state) : "memory");
+#endif
+	}
+
+	MemoryLock(const MemoryLock&) 				= delete;
+	MemoryLock& operator=(const MemoryLock&) 	= delete;
+
+private:
+	static constexpr uint32_t MSR_IE = 0x2;		// Interrupt enable bit of the Microblaze
+
+	uint32_t m_state = 0;
+};
+
+class Arena{
+public:
+	void 	Init(const char* name, void* base, size_t size);
+	void* 	Allocate(size_t size, size_t alignment = MEMORY_ALIGNMENT);	// Returns nullptr if the region is exhausted
+	size_t 	Mark() 				const;									// Current level, to be given to Release()
+	void 	Release(size_t mark);										// Frees everything allocated after the mark
+	size_t 	Available() 		const;
+
+	template<typename T>
+	T* Allocate(size_t count = 1)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	const char* 				Name() 			const { return m_name; 			}
+	const MemoryStatistics& 	Statistics() 	const { return m_statistics; 	}
+
+private:
+	const char* 		m_name 		= "";
+	uintptr_t 			m_base 		= 0;
+	MemoryStatistics 	m_statistics;
+};
+
+template<typename T, size_t N>
+class Pool{
+	static_assert(0 != N, "Pool can't be empty!");
+
+public:
+	/**
+	 * @brief	Carves the storage of all objects from the given arena
+	 * @return	false if the arena doesn't have enough space
+	 */
+	bool Init(const char* name, Arena& arena);
+
+	/**
+	 * @brief	Takes a slot from the free list, the object is not constructed
+	 * @return	nullptr if all slots are in use
+	 */
+	T* Allocate()
+	{
+		MemoryLock lock;
+
+		Slot* const slot = m_free;
+		if(nullptr == slot)
+		{
+			++m_statistics.failures;
+			return nullptr;
+		}
+
+		m_free = slot->next;
+		MarkFree(size_t(slot - m_slots), false);
+
+		if(++m_statistics.used > m_statistics.highWater)
+			m_statistics.highWater = m_statistics.used;
+
+		return reinterpret_cast<T*>(slot->storage);
+	}
+
+	/**
+	 * @brief	Returns a slot to the free list, the object is not destructed
+	 * @return	false if the object doesn't belong to this pool or is already free
+	 */
+	bool Free(T* object)
+	{
+		size_t index = 0;
+		if(!FindSlot(object, index))
+			return false;
+
+		MemoryLock lock;
+
+		// Linking it again would make the free list hand the slot out twice
+		if(IsFree(index))
+		{
+			++m_statistics.failures;
+			return false;
+		}
+
+		MarkFree(index, true);
+		m_slots[index].next = m_free;
+		m_free = &m_slots[index];
+		--m_statistics.used;
+
+		return true;
+	}
+
+	template<typename... Args>
+	T* New(Args&&... arguments)
+	{
+		T* const object = Allocate();
+
+		return (nullptr == object) ? nullptr : new(object) T(std::forward<Args>(arguments)...);
+	}
+
+	/**
+	 * @brief	Destructs the object and frees its slot
+	 * @return	false if the object doesn't belong to this pool or is already free, it isn't destructed then
+	 */
+	bool Delete(T* object)
+	{
+		if(nullptr == object)
+			return true;
+
+		size_t index = 0;
+		if(!FindSlot(object, index))
+			return false;
+
+		if(IsFree(index))
+		{
+			++m_statistics.failures;
+			return false;
+		}
+
+		object->~T();
+
+		return Free(object);
+	}
+
+	const MemoryStatistics& Statistics() const { return m_statistics; }
+
+private:
+	union Slot{
+		Slot* 						next;				// Valid while the slot is free
+		alignas(T) unsigned char 	storage[sizeof(T)];
+	};
+
+	// Index of the slot holding the object, false if it isn't one of the slots
+	bool FindSlot(const T* object, size_t& index) const
+	{
+		const uintptr_t address = reinterpret_cast<uintptr_t>(object);
+		const uintptr_t first 	= reinterpret_cast<uintptr_t>(m_slots);
+
+		if((address < first) || (address >= (first + sizeof(Slot) * N)) || (0 != ((address - first) % sizeof(Slot))))
+			return false;
+
+		index = (address - first) / sizeof(Slot);
+
+		return true;
+	}
+
+	bool IsFree(size_t index) const 			{ return 0 != (m_freeMap[index / 8] & (1u << (index % 8))); }
+	void MarkFree(size_t index, bool b_free)
+	{
+		if(b_free)
+			m_freeMap[index / 8] |= uint8_t(1u << (index % 8));
+		else
+			m_freeMap[index / 8] &= uint8_t(~(1u << (index % 8)));
+	}
+
+	Slot* 				m_slots 	= nullptr;
+	Slot* 				m_free 		= nullptr;
+	uint8_t 			m_freeMap[(N + 7) / 8] = {};	// A set bit for each slot in the free list
+	MemoryStatistics 	m_statistics;
+};
+
+/** Global Variables **/
+extern Arena memoryFast;
+extern Arena memoryBulk;
+
+/** Function Declarations **/
+void MemoryRegister(const char* name, const MemoryStatistics* statistics, const char* unit);	// Lists an entry in the report
+void MemoryPrintReport();
+
+/** Template Definitions **/
+template<typename T, size_t N>
+bool Pool<T, N>::Init(const char* name, Arena& arena)
+{
+	m_slots = arena.Allocate<Slot>(N);
+	if(nullptr == m_slots)
+		return false;
+
+	// Link all slots in address order
+	for(size_t idx = 0; idx < (N - 1); ++idx)
+	{
+		m_slots[idx].next = &m_slots[idx + 1];
+		MarkFree(idx, true);
+	}
+
+	m_slots[N - 1].next = nullptr;
+	MarkFree(N - 1, true);
+	m_free = m_slots;
+
+	m_statistics = MemoryStatistics{};
+	m_statistics.capacity = N;
+
+	MemoryRegister(name, &m_statistics, "objects");
+
+	return true;
+}
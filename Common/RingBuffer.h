@@ -0,0 +1,149 @@
+/**
+ * @brief	  	Single producer, single consumer ring buffer
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> In place writing added.
+ *
+ * @note		The producer and the consumer can be an ISR and the application loop of the
+ * 				same core. No locks are used, each index is written by only one side.
+ * 				Indices run freely and are wrapped with a mask, thus the capacity must be a
+ * 				power of two.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+// Prevents the compiler from reordering memory accesses around the index updates
+#define RING_BUFFER_BARRIER()	__asm__ volatile("" ::: "memory")
+
+template<typename T, size_t Capacity>
+class RingBuffer{
+	static_assert((0 != Capacity) && (0 == (Capacity & (Capacity - 1))), "Capacity must be a power of two!");
+
+public:
+	/**
+	 * @brief	Appends a single item (producer side)
+	 * @return	false if the buffer is full, the item is dropped in that case
+	 */
+	bool Push(const T& item)
+	{
+		const size_t head = m_head;
+
+		if((head - m_tail) >= Capacity)
+		{
+			++m_overflows;
+
+			return false;
+		}
+
+		m_buffer[head & MASK] = item;
+
+		RING_BUFFER_BARRIER();
+		m_head = head + 1;
+
+		return true;
+	}
+
+	/**
+	 * @brief	Removes the oldest item (consumer side)
+	 * @return	false if the buffer is empty
+	 */
+	bool Pop(T& item)
+	{
+		const size_t tail = m_tail;
+
+		if(tail == m_head)
+			return false;
+
+		item = m_buffer[tail & MASK];
+
+		RING_BUFFER_BARRIER();
+		m_tail = tail + 1;
+
+		return true;
+	}
+
+	/**
+	 * @brief	Appends as many items as fit (producer side)
+	 * @return	Number of items written
+	 */
+	size_t Write(const T* items, size_t count)
+	{
+		const size_t head 		= m_head;
+		const size_t available 	= Capacity - (head - m_tail);
+
+		if(count > available)
+		{
+			m_overflows += (count - available);
+			count = available;
+		}
+
+		for(size_t idx = 0; idx < count; ++idx)
+			m_buffer[(head + idx) & MASK] = items[idx];
+
+		RING_BUFFER_BARRIER();
+		m_head = head + count;
+
+		return count;
+	}
+
+	/**
+	 * @brief	Slot at the given offset after the last committed item (producer side)
+	 * @note	For writers that build their data in place. Nothing is visible to the consumer
+	 * 			until Commit(), the writer checks Free() beforehand.
+	 */
+	T& Staged(size_t offset)
+	{
+		return m_buffer[(m_head + offset) & MASK];
+	}
+
+	/**
+	 * @brief	Publishes the given number of staged items at once (producer side)
+	 */
+	void Commit(size_t count)
+	{
+		RING_BUFFER_BARRIER();
+		m_head = m_head + count;
+	}
+
+	/**
+	 * @brief	Removes up to the given number of items (consumer side)
+	 * @return	Number of items read
+	 */
+	size_t Read(T* items, size_t count)
+	{
+		const size_t tail 	= m_tail;
+		const size_t used 	= m_head - tail;
+
+		if(count > used)
+			count = used;
+
+		for(size_t idx = 0; idx < count; ++idx)
+			items[idx] = m_buffer[(tail + idx) & MASK];
+
+		RING_BUFFER_BARRIER();
+		m_tail = tail + count;
+
+		return count;
+	}
+
+	size_t 		Size() 		const { return m_head - m_tail; 	}
+	size_t 		Free() 		const { return Capacity - Size(); 	}
+	bool 		IsEmpty() 	const { return m_head == m_tail; 	}
+	bool 		IsFull() 	const { return Size() >= Capacity; 	}
+	uint32_t 	Overflows() const { return m_overflows; 		}
+
+	static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	static constexpr size_t MASK = Capacity - 1;
+
+	T 					m_buffer[Capacity];
+	volatile size_t 	m_head 		= 0;	// Written only by the producer
+	volatile size_t 	m_tail 		= 0;	// Written only by the consumer
+	volatile uint32_t 	m_overflows = 0;	// Number of dropped items
+};
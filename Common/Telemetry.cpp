@@ -0,0 +1,51 @@
+/**
+ * @brief	  	Compact binary telemetry frames for the serial links
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "Telemetry.h"
+
+/** Global Variables **/
+// CRC-16/CCITT-FALSE of each nibble, small enough for the LMB BRAM
+static const uint16_t crcNibbleTable[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static uint8_t 				sequence = 0;
+static TelemetryStatistics 	statistics;
+
+uint16_t TelemetryCrc(uint16_t crc, uint8_t byte)
+{
+	crc = uint16_t(crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (byte >> 4)];
+	crc = uint16_t(crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (byte & 0x0F)];
+
+	return crc;
+}
+
+uint8_t TelemetryNextSequence()
+{
+	return sequence++;
+}
+
+void TelemetryCount(size_t frameSize)
+{
+	if(0 == frameSize)
+	{
+		++statistics.dropped;
+
+		// The receiver sees the lost frame as a gap in the sequence
+		++sequence;
+		return;
+	}
+
+	++statistics.frames;
+	statistics.bytes += frameSize;
+}
+
+TelemetryStatistics TelemetryGetStatistics()
+{
+	return statistics;
+}
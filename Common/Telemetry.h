@@ -0,0 +1,178 @@
+/**
+ * @brief	  	Compact binary telemetry frames for the serial links
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		A frame carries a fixed header and one of the fixed layout payloads below:
+ *
+ * 				Version (1) | Type (1) | Sequence (1) | Length (1) | Timestamp (4) | Payload (Length) | CRC (2)
+ *
+ * 				Multi-byte fields are little endian. The CRC is CRC-16/CCITT-FALSE (polynomial
+ * 				0x1021, initial value 0xFFFF) over the header and the payload. The whole frame is
+ * 				COBS encoded and terminated by a zero byte. COBS removes the zeros from the frame,
+ * 				thus a receiver finds the next frame boundary after any corruption or when it
+ * 				joins an ongoing stream. The overhead is a byte per 254 bytes plus the delimiter.
+ * 				The sequence number wraps around, a gap tells the receiver how many frames were
+ * 				lost. Common/TelemetryDecoder.py decodes the frames on the host.
+ *
+ * 				The encoder writes the encoded bytes straight into the sink, there is no frame
+ * 				buffer in between. A sink is any byte container with the in place writing
+ * 				interface of the RingBuffer: Free(), Staged(offset). The frame is staged as a
+ * 				whole and the caller commits it, thus the consumer never sees a partial frame.
+ *
+ * 				Increase TELEMETRY_VERSION whenever a header or payload layout changes.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stddef.h>
+#include <stdint.h>
+
+/** Definitions **/
+#define TELEMETRY_VERSION 			1
+#define TELEMETRY_DELIMITER 		0x00
+#define TELEMETRY_MAX_PAYLOAD 		240
+#define TELEMETRY_MAX_SAMPLES 		((TELEMETRY_MAX_PAYLOAD - 2) / 2)
+
+// Encoded size of a frame in the worst case, including the delimiter
+#define TELEMETRY_FRAME_SIZE(payloadSize) 	\
+	((sizeof(TelemetryHeader) + (payloadSize) + 2) + (((sizeof(TelemetryHeader) + (payloadSize) + 2) / 254) + 1) + 1)
+
+/** Custom Structures **/
+enum TelemetryType : uint8_t{
+	TELEMETRY_SAMPLES 	= 1,	// TelemetrySamples
+	TELEMETRY_SWITCHES 	= 2,	// TelemetrySwitches
+};
+
+struct __attribute__((packed)) TelemetryHeader{
+	uint8_t 	version;
+	uint8_t 	type;
+	uint8_t 	sequence;
+	uint8_t 	length;			// Payload bytes
+	uint32_t 	timestamp;		// Time base of the sender
+};
+
+// Raw samples of a single channel, only the first "count" samples are sent
+struct __attribute__((packed)) TelemetrySamples{
+	uint8_t 	channel;
+	uint8_t 	count;
+	uint16_t 	samples[TELEMETRY_MAX_SAMPLES];
+};
+
+struct __attribute__((packed)) TelemetrySwitches{
+	uint32_t 	value;
+	uint32_t 	changed;		// Bits that differ from the previous frame
+};
+
+struct TelemetryStatistics{
+	uint32_t 	frames 		= 0;
+	uint32_t 	bytes 		= 0;	// Encoded bytes including the delimiters
+	uint32_t 	dropped 	= 0;	// Frames that didn't fit into the sink
+};
+
+// Plain buffer sink for a single frame, for the links without a TX ring
+struct TelemetryFrameBuffer{
+	uint8_t data[TELEMETRY_FRAME_SIZE(TELEMETRY_MAX_PAYLOAD)];
+
+	size_t 		Free() const 			{ return sizeof(data); 	}
+	uint8_t& 	Staged(size_t offset) 	{ return data[offset]; 	}
+};
+
+/** Function Declarations **/
+uint16_t 	TelemetryCrc(uint16_t crc, uint8_t byte);
+uint8_t 	TelemetryNextSequence();
+void 		TelemetryCount(size_t frameSize);		// Updates the statistics, zero for a dropped frame
+TelemetryStatistics TelemetryGetStatistics();
+
+/**
+ * @brief	COBS encoder writing straight into the staged area of a sink
+ */
+template<typename Sink>
+class TelemetryWriter{
+public:
+	explicit TelemetryWriter(Sink& sink) : m_sink(sink) {}
+
+	void Put(const uint8_t byte)
+	{
+		m_crc = TelemetryCrc(m_crc, byte);
+		Encode(byte);
+	}
+
+	void Put(const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+		for(size_t idx = 0; idx < size; ++idx)
+			Put(bytes[idx]);
+	}
+
+	// Appends the CRC and the delimiter, returns the size of the staged frame
+	size_t Finish()
+	{
+		const uint16_t crc = m_crc;
+
+		Encode(uint8_t(crc));
+		Encode(uint8_t(crc >> 8));
+
+		m_sink.Staged(m_codeOffset) = m_code;
+		m_sink.Staged(m_offset++) 	= TELEMETRY_DELIMITER;
+
+		return m_offset;
+	}
+
+private:
+	void Encode(const uint8_t byte)
+	{
+		if(0 != byte)
+		{
+			m_sink.Staged(m_offset++) = byte;
+
+			if(0xFF != ++m_code)
+				return;
+		}
+
+		// A zero or a full block closes the block, its code byte is filled in afterwards
+		m_sink.Staged(m_codeOffset) = m_code;
+		m_codeOffset 	= m_offset++;
+		m_code 			= 1;
+	}
+
+	Sink& 		m_sink;
+	size_t 		m_offset 		= 1;		// Next byte, the first one is the code of the first block
+	size_t 		m_codeOffset 	= 0;
+	uint8_t 	m_code 			= 1;
+	uint16_t 	m_crc 			= 0xFFFF;
+};
+
+/**
+ * @brief	Stages a frame in the sink, the caller commits the returned number of bytes
+ * @return	Size of the frame, zero if it doesn't fit (counted as dropped)
+ */
+template<typename Sink>
+size_t TelemetryEncode(Sink& sink, TelemetryType type, uint32_t timestamp, const void* payload, size_t size)
+{
+	if((size > TELEMETRY_MAX_PAYLOAD) || (sink.Free() < TELEMETRY_FRAME_SIZE(size)))
+	{
+		TelemetryCount(0);
+		return 0;
+	}
+
+	const TelemetryHeader header{TELEMETRY_VERSION, type, TelemetryNextSequence(), uint8_t(size), timestamp};
+
+	TelemetryWriter<Sink> writer(sink);
+	writer.Put(&header, sizeof(header));
+	writer.Put(payload, size);
+
+	const size_t frameSize = writer.Finish();
+	TelemetryCount(frameSize);
+
+	return frameSize;
+}
+
+// Sends only the used part of the sample array
+template<typename Sink>
+size_t TelemetryEncodeSamples(Sink& sink, uint32_t timestamp, const TelemetrySamples& samples)
+{
+	return TelemetryEncode(sink, TELEMETRY_SAMPLES, timestamp, &samples, 2 + (2 * size_t(samples.count)));
+}
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+# Brief     : Host side streaming decoder of the binary telemetry frames (see Telemetry.h)
+# Author    : Caglayan DOKME, caglayandokme@gmail.com
+# Date      : October 19, 2026
+# Note      : Frames are COBS encoded and delimited by zero bytes. A segment that doesn't decode
+#           : into a valid frame is passed through if it is printable text (e.g. plain printf
+#           : output), otherwise it is counted as corrupted. The summary goes to stderr.
+# Usage     : Decode a captured stream
+#           :   ./TelemetryDecoder.py capture.bin
+#           : Decode a live serial port into CSV (configure the port with stty beforehand)
+#           :   ./TelemetryDecoder.py --csv /dev/ttyUSB1
+#           : Check the decoder against generated streams with noise and corruption, and against
+#           : the stream of the C++ encoder in TelemetryFixture.bin (see TelemetryFixture.cpp)
+#           :   ./TelemetryDecoder.py --selftest
+
+import argparse
+import os
+import random
+import struct
+import sys
+
+VERSION = 1
+DELIMITER = 0x00
+HEADER = struct.Struct('<BBBBI')        # Version, type, sequence, length, timestamp
+MAX_PAYLOAD = 240
+
+TYPE_SAMPLES = 1
+TYPE_SWITCHES = 2
+
+FIXTURE = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'TelemetryFixture.bin')
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+
+    return crc
+
+
+def cobs_decode(data):
+    """Returns the decoded bytes, None if the encoding is broken."""
+    output = bytearray()
+    index = 0
+    while index < len(data):
+        code = data[index]
+        if code == 0 or index + code > len(data):
+            return None
+
+        output.extend(data[index + 1:index + code])
+        index += code
+
+        if code < 0xFF and index < len(data):
+            output.append(0)
+
+    return bytes(output)
+
+
+def cobs_encode(data):
+    output = bytearray([0])
+    codeIndex = 0
+    code = 1
+    for byte in data:
+        if byte:
+            output.append(byte)
+            code += 1
+
+        if not byte or code == 0xFF:
+            output[codeIndex] = code
+            codeIndex = len(output)
+            output.append(0)
+            code = 1
+
+    output[codeIndex] = code
+    return bytes(output)
+
+
+def encode_frame(frameType, sequence, timestamp, payload):
+    """Same frame as TelemetryEncode(), for the self test."""
+    body = HEADER.pack(VERSION, frameType, sequence & 0xFF, len(payload), timestamp) + payload
+    return cobs_encode(body + struct.pack('<H', crc16(body))) + bytes([DELIMITER])
+
+
+def parse_frame(frame):
+    """Returns (type, sequence, timestamp, fields) or None if the frame is invalid."""
+    if len(frame) < HEADER.size + 2 or crc16(frame[:-2]) != struct.unpack_from('<H', frame, len(frame) - 2)[0]:
+        return None
+
+    version, frameType, sequence, length, timestamp = HEADER.unpack_from(frame)
+    payload = frame[HEADER.size:-2]
+    if version != VERSION or length != len(payload):
+        return None
+
+    if frameType == TYPE_SAMPLES and length >= 2 and length == 2 + 2 * payload[1]:
+        fields = (payload[0], list(struct.unpack_from('<%dH' % payload[1], payload, 2)))
+    elif frameType == TYPE_SWITCHES and length == 8:
+        fields = struct.unpack('<II', payload)
+    else:
+        fields = (payload.hex(),)
+
+    return frameType, sequence, timestamp, fields
+
+
+class Decoder:
+    def __init__(self, output, csv=False):
+        self.output = output
+        self.csv = csv
+        self.buffer = bytearray()
+        self.frames = 0
+        self.corrupted = 0
+        self.lost = 0
+        self.samples = 0
+        self.bytes = 0
+        self.lastSequence = None
+        self.records = []
+
+    def feed(self, chunk):
+        """Decodes the complete segments of the chunk, keeps the rest for the next one."""
+        self.bytes += len(chunk)
+        self.buffer.extend(chunk)
+
+        while True:
+            end = self.buffer.find(DELIMITER)
+            if end < 0:
+                break
+
+            segment = bytes(self.buffer[:end])
+            del self.buffer[:end + 1]
+
+            if segment:
+                self.segment(segment)
+
+    def segment(self, segment):
+        frame = cobs_decode(segment)
+        parsed = parse_frame(frame) if frame is not None else None
+
+        if parsed is None:
+            text = segment.decode('ascii', errors='replace')
+            if text.isprintable() or text.strip('\r\n\t').isprintable():
+                self.output.write(text)
+            else:
+                self.corrupted += 1
+            return
+
+        frameType, sequence, timestamp, fields = parsed
+        if self.lastSequence is not None:
+            self.lost += (sequence - self.lastSequence - 1) & 0xFF
+        self.lastSequence = sequence
+        self.frames += 1
+        self.records.append(parsed)
+
+        if frameType == TYPE_SAMPLES:
+            channel, samples = fields
+            self.samples += len(samples)
+            if self.csv:
+                self.output.write('samples,%u,%u,%u,%s\n' % (sequence, timestamp, channel, ','.join(map(str, samples))))
+            else:
+                self.output.write('[%3u] %10u  channel %u, %u samples: %s\n' % (
+                    sequence, timestamp, channel, len(samples), ' '.join('%04x' % s for s in samples)))
+        elif frameType == TYPE_SWITCHES:
+            value, changed = fields
+            if self.csv:
+                self.output.write('switches,%u,%u,%u,%u\n' % (sequence, timestamp, value, changed))
+            else:
+                self.output.write('[%3u] %10u  switches %s (changed %s)\n' % (
+                    sequence, timestamp, format(value, '04b'), format(changed, '04b')))
+        else:
+            self.output.write('[%3u] %10u  type %u: %s\n' % (sequence, timestamp, frameType, fields[0]))
+
+    def summary(self):
+        perSample = (self.bytes / self.samples) if self.samples else 0
+        return ('%u frames, %u samples, %u bytes (%.2f bytes/sample), %u corrupted, %u lost' %
+                (self.frames, self.samples, self.bytes, perSample, self.corrupted, self.lost))
+
+
+class NullOutput:
+    def write(self, text):
+        pass
+
+    def flush(self):
+        pass
+
+
+class TextOutput(NullOutput):
+    def __init__(self):
+        self.text = ''
+
+    def write(self, text):
+        self.text += text
+
+
+def decode(stream, decoder):
+    while True:
+        chunk = stream.read(1024)
+        if not chunk:
+            break
+
+        decoder.feed(chunk)
+        decoder.output.flush()
+
+
+def fixture_frames():
+    """Frames written by TelemetryFixture.cpp, the dropped one excluded."""
+    frames = []
+    for sequence in range(200):
+        timestamp = 0x12340000 + sequence * 1000
+        if sequence == 100:
+            continue
+
+        if sequence % 4 == 3:
+            payload = struct.pack('<II', sequence & 0xF, (sequence ^ (sequence - 1)) & 0xF)
+            frameType = TYPE_SWITCHES
+        else:
+            count = 1 + (sequence * 37) % ((MAX_PAYLOAD - 2) // 2)
+            samples = [0 if idx % 5 == 0 else (sequence * 257 + idx * 13) & 0xFFFF for idx in range(count)]
+            payload = struct.pack('<BB%dH' % count, sequence % 8, count, *samples)
+            frameType = TYPE_SAMPLES
+
+        frames.append((frameType, sequence, timestamp, payload))
+
+    return frames
+
+
+def selftest():
+    generator = random.Random(2026)
+    frames = []
+    stream = bytearray(b'Boot message before the stream\r\n\x00')
+
+    for sequence in range(2000):
+        if sequence % 3:
+            count = generator.randint(1, (MAX_PAYLOAD - 2) // 2)
+            samples = [generator.choice((0, 0x0100, 0xFFFF, generator.randint(0, 0xFFFF))) for _ in range(count)]
+            payload = struct.pack('<BB%dH' % count, sequence % 8, count, *samples)
+            frameType = TYPE_SAMPLES
+        else:
+            payload = struct.pack('<II', generator.randint(0, 15), generator.randint(0, 15))
+            frameType = TYPE_SWITCHES
+
+        frames.append((frameType, sequence & 0xFF, sequence * 1000, payload))
+        stream.extend(encode_frame(frameType, sequence, sequence * 1000, payload))
+
+    failures = []
+
+    # Clean stream fed in random chunk sizes
+    decoder = Decoder(NullOutput())
+    position = 0
+    while position < len(stream):
+        size = generator.randint(1, 300)
+        decoder.feed(stream[position:position + size])
+        position += size
+
+    if decoder.frames != len(frames) or decoder.corrupted or decoder.lost:
+        failures.append('clean stream: ' + decoder.summary())
+    elif [(r[0], r[1], r[2]) for r in decoder.records] != [(f[0], f[1], f[2]) for f in frames]:
+        failures.append('clean stream: frame contents differ')
+
+    # Flipped bits and a dropped frame, the decoder must resynchronize at the next delimiter
+    damaged = bytearray(stream)
+    boundaries = [index for index, byte in enumerate(damaged) if byte == DELIMITER]
+    for frame in (100, 500, 1500):
+        start = boundaries[frame] + 1
+        damaged[start + 3] ^= 0x5A if damaged[start + 3] ^ 0x5A else 0x55
+    del damaged[boundaries[1000] + 1:boundaries[1001] + 1]
+
+    decoder = Decoder(NullOutput())
+    decoder.feed(damaged)
+    if decoder.frames != len(frames) - 4 or decoder.corrupted != 3 or decoder.lost != 4:
+        failures.append('damaged stream: ' + decoder.summary())
+
+    # Stream of the C++ encoder, byte by byte the same as the frames encoded here
+    frames = fixture_frames()
+    with open(FIXTURE, 'rb') as stream:
+        fixture = stream.read()
+
+    expected = b'Fixture of the C++ encoder\r\n\x00' + b''.join(encode_frame(*frame) for frame in frames)
+    if fixture != expected:
+        failures.append('C++ fixture: stream differs from the Python encoder')
+
+    text = TextOutput()
+    decoder = Decoder(text)
+    decoder.feed(fixture)
+    if decoder.frames != len(frames) or decoder.corrupted or decoder.lost != 1:
+        failures.append('C++ fixture: ' + decoder.summary())
+    elif [r[:3] for r in decoder.records] != [f[:3] for f in frames]:
+        failures.append('C++ fixture: frame headers differ')
+    elif not text.text.startswith('Fixture of the C++ encoder'):
+        failures.append('C++ fixture: text is not passed through')
+
+    # Payload size of a sample compared with a "VCC INT: %f\r\n" line
+    textBytes = len('VCC INT: %f\r\n' % 0.998046875)
+    frameBytes = len(encode_frame(TYPE_SAMPLES, 0, 0, struct.pack('<BB119H', 0, 119, *([0x5555] * 119))))
+    print('text %u bytes/sample, binary %.2f bytes/sample, %.1fx more samples per second' %
+          (textBytes, frameBytes / 119, textBytes / (frameBytes / 119)))
+
+    for failure in failures:
+        print('FAIL ' + failure)
+
+    print('Self test ' + ('failed' if failures else 'passed'))
+    return not failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes the binary telemetry stream.')
+    parser.add_argument('input', nargs='?', help='Captured stream or serial device, "-" for stdin')
+    parser.add_argument('--csv', action='store_true', help='Print one CSV line per frame')
+    parser.add_argument('--selftest', action='store_true', help='Decode generated streams and check the results')
+    args = parser.parse_args()
+
+    if args.selftest:
+        sys.exit(0 if selftest() else 1)
+
+    if args.input is None:
+        parser.error('the input is required')
+
+    decoder = Decoder(sys.stdout, args.csv)
+
+    try:
+        if args.input == '-':
+            decode(sys.stdin.buffer, decoder)
+        else:
+            with open(args.input, 'rb', buffering=0) as stream:
+                decode(stream, decoder)
+    except KeyboardInterrupt:
+        pass
+
+    sys.stderr.write(decoder.summary() + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,99 @@
+/**
+ * @file 	TelemetryFixture.cpp
+ * @brief	Host program writing a telemetry stream with the encoder of the targets.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The stream is committed as TelemetryFixture.bin, TelemetryDecoder.py --selftest
+ * 			decodes it and compares it with the frames it expects. The frames are encoded into
+ * 			a small ring, so that they wrap around its end as they do in the UART TX ring, and
+ * 			into a frame buffer. A frame is dropped on purpose to leave a gap in the sequence.
+ * 			Keep the contents in sync with fixture_frames() of the decoder, and regenerate the
+ * 			fixture after a change of the encoder or the frame layout:
+ *
+ * 			g++ -std=gnu++11 -I. TelemetryFixture.cpp Telemetry.cpp -o TelemetryFixture
+ * 			./TelemetryFixture > TelemetryFixture.bin
+ */
+
+/** Libraries **/
+#include "Telemetry.h"
+#include "RingBuffer.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Definitions **/
+#define FIXTURE_FRAMES 		200
+#define FIXTURE_DROPPED 	100		// Sequence of the frame which doesn't fit into its sink
+#define FIXTURE_TIMESTAMP 	0x12340000
+
+/** Custom Structures **/
+// Never has room, the encoder drops the frame
+struct FullSink{
+	uint8_t dummy;
+
+	size_t 		Free() const 			{ return 0; 	}
+	uint8_t& 	Staged(size_t offset) 	{ return dummy; }
+};
+
+/** Global Variables **/
+static RingBuffer<uint8_t, 512> ring;
+
+static void Drain()
+{
+	uint8_t byte = 0;
+
+	while(ring.Pop(byte))
+		putchar(byte);
+}
+
+int main()
+{
+	// Plain text before the frames, as a boot message would be
+	const char text[] = "Fixture of the C++ encoder\r\n";
+	fwrite(text, 1, strlen(text), stdout);
+	putchar(TELEMETRY_DELIMITER);
+
+	for(uint32_t sequence = 0; sequence < FIXTURE_FRAMES; ++sequence)
+	{
+		const uint32_t timestamp = FIXTURE_TIMESTAMP + (sequence * 1000);
+
+		if(FIXTURE_DROPPED == sequence)
+		{
+			FullSink sink;
+			const TelemetrySwitches switches{0, 0};
+
+			if(0 != TelemetryEncode(sink, TELEMETRY_SWITCHES, timestamp, &switches, sizeof(switches)))
+				return 1;
+		}
+		else if(3 == (sequence % 4))
+		{
+			const TelemetrySwitches switches{sequence & 0xF, (sequence ^ (sequence - 1)) & 0xF};
+
+			TelemetryFrameBuffer frame;
+			const size_t size = TelemetryEncode(frame, TELEMETRY_SWITCHES, timestamp, &switches, sizeof(switches));
+
+			fwrite(frame.data, 1, size, stdout);
+		}
+		else
+		{
+			// Zero samples, thus zero bytes for the COBS encoding
+			TelemetrySamples samples;
+			samples.channel = uint8_t(sequence % 8);
+			samples.count 	= uint8_t(1 + ((sequence * 37) % TELEMETRY_MAX_SAMPLES));
+
+			for(uint8_t idx = 0; idx < samples.count; ++idx)
+				samples.samples[idx] = (0 == (idx % 5)) ? 0 : uint16_t((sequence * 257) + (idx * 13));
+
+			const size_t size = TelemetryEncodeSamples(ring, timestamp, samples);
+			if(0 == size)
+				return 1;
+
+			ring.Commit(size);
+			Drain();
+		}
+	}
+
+	const TelemetryStatistics statistics = TelemetryGetStatistics();
+
+	return ((FIXTURE_FRAMES - 1) == statistics.frames) && (1 == statistics.dropped) ? 0 : 1;
+}
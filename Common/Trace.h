@@ -0,0 +1,90 @@
+/**
+ * @brief	  	Level filtered tracing with zero cost for the disabled statements
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Each module declares its own compile time level. A trace statement above that
+ * 				level (or above TRACE_MAX_LEVEL) has a constant false condition, thus neither the
+ * 				format string nor the argument expressions make it into the binary. Enabled
+ * 				statements are additionally filtered by a runtime ceiling.
+ *
+ * 				#ifndef TRACE_LEVEL_TTC
+ * 				#define TRACE_LEVEL_TTC		TRACE_LEVEL_INFO	// Override with -DTRACE_LEVEL_TTC=...
+ * 				#endif
+ *
+ * 				TRACE_MODULE(TraceTtc, TRACE_LEVEL_TTC)
+ *
+ * 				TRACE(TraceTtc, TRACE_LEVEL_DEBUG, "Interval: %u\n", interval);
+ * 				TRACE_DEFERRED(TraceTtc, TRACE_LEVEL_INFO, LOG_EVENT);	// Needs DeferredLog.h
+ *
+ * 				Release builds define TRACE_MAX_LEVEL (e.g. -DTRACE_MAX_LEVEL=TRACE_LEVEL_ERROR)
+ * 				to cap every module at once.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stdint.h>
+#include <stdio.h>
+
+/** Custom Structures **/
+enum TraceLevel : uint8_t {
+	TRACE_LEVEL_OFF = 0,
+	TRACE_LEVEL_ERROR,
+	TRACE_LEVEL_WARNING,
+	TRACE_LEVEL_INFO,
+	TRACE_LEVEL_DEBUG,
+	TRACE_LEVEL_VERBOSE
+};
+
+/** Definitions **/
+#ifndef TRACE_MAX_LEVEL
+#define TRACE_MAX_LEVEL		TRACE_LEVEL_VERBOSE		// Upper bound of all the modules
+#endif
+
+// Declares a module tag with its compile time level
+#define TRACE_MODULE(module, level) 	struct module { static constexpr TraceLevel compileLevel = level; };
+
+// Formats immediately, use it out of the hot paths
+#define TRACE(module, level, ...) 											\
+	do{																		\
+		if(TraceIsCompiled<module, level>::value && TraceIsAllowed(level))	\
+			printf(__VA_ARGS__);											\
+	}while(0)
+
+// Stores a deferred log record, the arguments are a format ID and its values
+#define TRACE_DEFERRED(module, level, ...) 									\
+	do{																		\
+		if(TraceIsCompiled<module, level>::value && TraceIsAllowed(level))	\
+			DeferredLog(__VA_ARGS__);										\
+	}while(0)
+
+/** Compile Time Filter **/
+template<typename Module, TraceLevel Level>
+struct TraceIsCompiled{
+	static constexpr bool value = (TRACE_LEVEL_OFF != Level) && (Level <= Module::compileLevel) && (Level <= TRACE_MAX_LEVEL);
+};
+
+/** Runtime Filter **/
+// Single instance across all the translation units
+inline volatile uint8_t& TraceCeiling()
+{
+	static volatile uint8_t ceiling = TRACE_LEVEL_VERBOSE;
+
+	return ceiling;
+}
+
+inline bool TraceIsAllowed(const TraceLevel level)
+{
+	return level <= TraceCeiling();
+}
+
+inline void TraceSetCeiling(const TraceLevel level)
+{
+	TraceCeiling() = level;
+}
+
+inline TraceLevel TraceGetCeiling()
+{
+	return TraceLevel(TraceCeiling());
+}
@@ -0,0 +1,62 @@
+/**
+ * @file 	Benchmark.h
+ * @brief	Timing harness of the host benchmarks.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	A case runs its body for a warm-up pass and then for the given number of operations.
+ * 			It prints a single result line, which BenchmarkRunner.py collects:
+ *
+ * 			BENCH <name> <operations> <nanoseconds> <cycles>
+ *
+ * 			Cycles are read from the time stamp counter on x86 hosts (reference cycles, not the
+ * 			core clock when it is scaled), zero elsewhere. The body gets the operation index and
+ * 			must leave the simulated peripherals ready for the next call.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/** Function Declarations **/
+static inline uint64_t BenchmarkCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+// Keeps the compiler from dropping a result that is never used otherwise
+template<typename T>
+static inline void BenchmarkKeep(const T& value)
+{
+	asm volatile("" : : "r"(&value) : "memory");
+}
+
+template<typename Body>
+void BenchmarkRun(const char* name, const uint32_t operations, Body body)
+{
+	// Caches, branch predictors and the lazily bound symbols
+	for(uint32_t idx = 0; idx < (operations / 10) + 1; ++idx)
+		body(idx);
+
+	const auto 		start 		= std::chrono::steady_clock::now();
+	const uint64_t 	startCycles = BenchmarkCycles();
+
+	for(uint32_t idx = 0; idx < operations; ++idx)
+		body(idx);
+
+	const uint64_t 	cycles 	= BenchmarkCycles() - startCycles;
+	const auto 		elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+	printf("BENCH %s %u %llu %llu\n", name, unsigned(operations), (unsigned long long)(elapsed.count()), (unsigned long long)(cycles));
+}
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+# Brief     : Builds the host benchmarks of the examples, runs them repeatedly and compares the
+#           : results with a stored baseline
+# Author    : Caglayan DOKME, caglayandokme@gmail.com
+# Date      : October 19, 2026
+# Note      : Each benchmark is built from the application sources with the simulated peripherals
+#           : of Common/HostSim (see Readme.md). A benchmark binary prints a line per case,
+#           : every case is run "repeats" times and the per operation statistics are computed from
+#           : those runs. The median (or the minimum on a noisy host) is compared with the baseline,
+#           : a case slower than the threshold fails the run. Baselines are only comparable on the
+#           : same host and compiler.
+# Usage     : Run all benchmarks and store the results as the baseline
+#           :   ./BenchmarkRunner.py --save-baseline baseline.json
+#           : Run them again later and fail if a case is more than 10% slower
+#           :   ./BenchmarkRunner.py --baseline baseline.json --threshold 10 --output results.json
+#           : Only some of the benchmarks, more repeats
+#           :   ./BenchmarkRunner.py --only xadc,dma --repeats 15
+
+import argparse
+import json
+import os
+import platform
+import shlex
+import statistics
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Sources and include paths of each benchmark, relative to the repository root
+BENCHMARKS = {
+    'dma': {
+        'sources': ['HostBenchmark/DmaLoopBench.cpp', 'ZynqPsDma/SwProject/DmaTransfer.cpp', 'Common/MemoryPool.cpp'],
+        'includes': ['Common/HostSim', 'ZynqPsDma/SwProject', 'HostBenchmark', 'Common'],
+    },
+    'gpio': {
+        'sources': ['HostBenchmark/GpioUpdateBench.cpp', 'MicroblazeDDR/SwProject/GpioEvents.cpp'],
+        'includes': ['MicroblazeDDR/SwProject/HostSim', 'Common/HostSim', 'MicroblazeDDR/SwProject', 'HostBenchmark', 'Common'],
+    },
+    'ttc': {
+        'sources': ['HostBenchmark/TtcEventBench.cpp', 'ZynqTripleTimerCounter/SwProject/TtcSetup.cpp', 'Common/DeferredLog.cpp'],
+        'includes': ['Common/HostSim', 'ZynqTripleTimerCounter/SwProject', 'HostBenchmark', 'Common'],
+    },
+    'trace': {
+        'sources': ['HostBenchmark/TraceBench.cpp', 'ZynqPsDma/SwProject/DmaTransfer.cpp', 'Common/MemoryPool.cpp',
+                    'Common/DeferredLog.cpp'],
+        'includes': ['Common/HostSim', 'ZynqPsDma/SwProject', 'HostBenchmark', 'Common'],
+    },
+    'xadc': {
+        'sources': ['HostBenchmark/XadcConversionBench.cpp', 'ZedboardXadc/SwProject/XadcAcquisition.cpp',
+                    'ZedboardXadc/SwProject/XadcCalibration.cpp', 'ZedboardXadc/SwProject/XadcDsp.cpp',
+                    'Common/Telemetry.cpp'],
+        'includes': ['Common/HostSim', 'ZedboardXadc/SwProject', 'HostBenchmark', 'Common'],
+    },
+    'shared': {
+        'sources': ['HostBenchmark/SharedExchangeBench.cpp', 'SharedBram/SharedBramSwProject/SharedBramExchange.c'],
+        'includes': ['MicroblazeDDR/SwProject/HostSim', 'Common/HostSim', 'SharedBram/SharedBramSwProject', 'ZynqAmp/SwProject',
+                     'HostBenchmark', 'Common'],
+    },
+}
+
+
+def build(name, benchmark, buildDir, compiler, flags):
+    binary = os.path.join(buildDir, name + 'Bench')
+    command = compiler + flags + ['-I' + os.path.join(ROOT, path) for path in benchmark['includes']]
+    command += [os.path.join(ROOT, source) for source in benchmark['sources']] + ['-o', binary]
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        sys.stderr.write('Build of %s failed:\n%s\n%s\n' % (name, ' '.join(command), result.stdout))
+        return None
+
+    return binary
+
+
+def run(binary):
+    """Returns {case: (operations, nanoseconds, cycles)} of a single run."""
+    result = subprocess.run([binary], stdout=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        raise RuntimeError('%s exited with %d' % (os.path.basename(binary), result.returncode))
+
+    cases = {}
+    for line in result.stdout.splitlines():
+        fields = line.split()
+        if len(fields) == 5 and fields[0] == 'BENCH':
+            cases[fields[1]] = (int(fields[2]), int(fields[3]), int(fields[4]))
+
+    return cases
+
+
+def summarize(benchmark, runs):
+    """Per operation statistics of the runs of a case."""
+    operations = runs[0][0]
+    nanoseconds = [ns / operations for _, ns, _ in runs]
+    cycles = [cycles / operations for _, _, cycles in runs]
+
+    return {
+        'benchmark': benchmark,
+        'operations': operations,
+        'runs': len(runs),
+        'ns_min': min(nanoseconds),
+        'ns_median': statistics.median(nanoseconds),
+        'ns_mean': statistics.mean(nanoseconds),
+        'ns_stdev': statistics.stdev(nanoseconds) if len(nanoseconds) > 1 else 0.0,
+        'cycles_median': statistics.median(cycles) if any(cycles) else None,
+    }
+
+
+def host_info(compiler, flags):
+    version = subprocess.run(compiler + ['--version'], stdout=subprocess.PIPE, universal_newlines=True).stdout
+    return {
+        'host': platform.node(),
+        'machine': platform.machine(),
+        'processor': platform.processor(),
+        'compiler': version.splitlines()[0] if version else '',
+        'flags': ' '.join(flags),
+        'time': time.strftime('%Y-%m-%dT%H:%M:%S'),
+    }
+
+
+def compare(results, baseline, threshold, statistic, names):
+    """Prints the comparison table, returns the names of the regressed cases."""
+    regressions = []
+
+    print('%-28s %12s %12s %9s %12s  %s' % ('Case', 'ns/op', 'Baseline', 'Change', 'cycles/op', ''))
+    for case, current in sorted(results['cases'].items()):
+        cycles = '%12.1f' % current['cycles_median'] if current['cycles_median'] is not None else '%12s' % '-'
+        reference = baseline['cases'].get(case) if baseline else None
+
+        if reference is None:
+            print('%-28s %12.2f %12s %9s %s  %s' % (case, current[statistic], '-', '-', cycles, 'new' if baseline else ''))
+            continue
+
+        change = 100.0 * (current[statistic] - reference[statistic]) / reference[statistic]
+        verdict = ''
+        if change > threshold:
+            verdict = 'REGRESSION'
+            regressions.append(case)
+        elif change < -threshold:
+            verdict = 'improved'
+
+        print('%-28s %12.2f %12.2f %+8.1f%% %s  %s' % (case, current[statistic], reference[statistic], change, cycles, verdict))
+
+    if baseline:
+        # Cases of the benchmarks that weren't run aren't missing
+        for case in sorted(set(baseline['cases']) - set(results['cases'])):
+            if baseline['cases'][case].get('benchmark') not in names:
+                continue
+
+            print('%-28s %12s %12.2f %9s %12s  missing' % (case, '-', baseline['cases'][case][statistic], '-', '-'))
+
+        if baseline.get('info', {}).get('compiler') != results['info']['compiler']:
+            print('\nWARNING: The baseline was built with "%s"' % baseline.get('info', {}).get('compiler'))
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Runs the host benchmarks and compares them with a baseline.')
+    parser.add_argument('--only', help='Comma separated benchmarks to run (%s)' % ','.join(BENCHMARKS))
+    parser.add_argument('--repeats', type=int, default=5, help='Runs of each benchmark (default 5)')
+    parser.add_argument('--build-dir', default=os.path.join(ROOT, 'HostBenchmark', '_build'), help='Binaries go here')
+    parser.add_argument('--output', help='Write the results as JSON')
+    parser.add_argument('--baseline', help='Compare with the results stored in this JSON file')
+    parser.add_argument('--threshold', type=float, default=10.0, help='Allowed slowdown in percent (default 10)')
+    parser.add_argument('--statistic', choices=('median', 'min'), default='median', help='Compared statistic of the runs (default median)')
+    parser.add_argument('--save-baseline', help='Write the results as the new baseline')
+    args = parser.parse_args()
+
+    names = args.only.split(',') if args.only else list(BENCHMARKS)
+    unknown = [name for name in names if name not in BENCHMARKS]
+    if unknown:
+        parser.error('unknown benchmarks: ' + ', '.join(unknown))
+
+    if args.repeats < 1:
+        parser.error('at least a single repeat is needed')
+
+    # CXX and CXXFLAGS override the host compiler and the optimization level
+    compiler = shlex.split(os.environ.get('CXX', 'g++'))
+    flags = shlex.split(os.environ.get('CXXFLAGS', '-std=gnu++11 -O2 -Wall'))
+
+    baseline = None
+    if args.baseline:
+        with open(args.baseline) as stream:
+            baseline = json.load(stream)
+
+    os.makedirs(args.build_dir, exist_ok=True)
+    results = {'info': host_info(compiler, flags), 'repeats': args.repeats, 'cases': {}}
+
+    for name in names:
+        binary = build(name, BENCHMARKS[name], args.build_dir, compiler, flags)
+        if binary is None:
+            sys.exit(2)
+
+        # Runs of the same binary are interleaved with nothing else, the median smooths the noise
+        runs = {}
+        for _ in range(args.repeats):
+            try:
+                cases = run(binary)
+            except RuntimeError as error:
+                sys.stderr.write('%s\n' % error)
+                sys.exit(2)
+
+            for case, values in cases.items():
+                runs.setdefault(case, []).append(values)
+
+        for case, values in runs.items():
+            results['cases'][case] = summarize(name, values)
+
+        sys.stderr.write('%s: %d cases\n' % (name, len(runs)))
+
+    regressions = compare(results, baseline, args.threshold, 'ns_' + args.statistic, names)
+
+    for path in (args.output, args.save_baseline):
+        if path:
+            with open(path, 'w') as stream:
+                json.dump(results, stream, indent=2, sort_keys=True)
+                stream.write('\n')
+
+    if regressions:
+        print('\n%d of %d cases are more than %.1f%% slower than the baseline: %s' %
+              (len(regressions), len(results['cases']), args.threshold, ', '.join(regressions)))
+        sys.exit(1)
+
+    if baseline:
+        print('\nNo case is more than %.1f%% slower than the baseline' % args.threshold)
+
+
+if __name__ == '__main__':
+    main()
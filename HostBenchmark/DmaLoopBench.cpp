@@ -0,0 +1,67 @@
+/**
+ * @file 	DmaLoopBench.cpp
+ * @brief	Transfer loop of the ZynqPsDma example on the simulated DMA controller.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Built with the transfer loop of the example.
+ * 			October 19, 2026 -> Commands taken from the pool of the example.
+ *
+ * @note	The loop step of the example (DmaTransfer.cpp) is built as is: wait for the done
+ * 			flag, verify the destination, update the source and restart the transfer. The
+ * 			buffers come from the same arenas, heap blocks stand for the DDR and the OCM.
+ */
+
+/** Libraries **/
+#include "xdmaps.h"
+#include "DmaTransfer.h"
+#include "MemoryPool.h"
+#include "Benchmark.h"
+#include <stdlib.h>
+
+/** Definitions **/
+#define OCM_ARENA_SIZE 		(62 * 1024)
+#define DDR_ARENA_SIZE 		(1024 * 1024)
+
+/** Hardware Instances **/
+static XDmaPs dma;
+
+static void RunCase(const char* name, const size_t size, const uint32_t operations)
+{
+	uint8_t* const source 	= memoryBulk.Allocate<uint8_t>(size);
+	uint8_t* const dest 	= memoryFast.Allocate<uint8_t>(size);
+
+	if((nullptr == source) || (nullptr == dest))
+		exit(1);
+
+	for(size_t idx = 0; idx < size; ++idx)
+		source[idx] = uint8_t(idx);
+
+	if(!DmaStart(&dma, source, dest, size))
+		exit(1);
+
+	BenchmarkRun(name, operations, [&](uint32_t idx) {
+		if(!DmaLoopStep(&dma, source, dest, size))
+		{
+			printf("Transfer %u failed!\n", unsigned(idx));
+			exit(1);
+		}
+	});
+}
+
+int main()
+{
+	memoryFast.Init("OCM", malloc(OCM_ARENA_SIZE), OCM_ARENA_SIZE);
+	memoryBulk.Init("DDR", malloc(DDR_ARENA_SIZE), DDR_ARENA_SIZE);
+
+	if(!DmaTransferInit(memoryFast))
+		return 1;
+
+	if(XST_SUCCESS != XDmaPs_SetDoneHandler(&dma, 0, DmaDoneHandler, nullptr))
+		return 1;
+
+	// The buffer size of the example and a larger one
+	RunCase("dma_loop_128", 	128, 	200000);
+	RunCase("dma_loop_4096", 	4096, 	20000);
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file 	GpioUpdateBench.cpp
+ * @brief	Switch update path of the MicroblazeDDR example on the simulated AXI GPIO.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The GPIO event pipeline is built as is, with the simulated AXI GPIO of the example's
+ * 			HostSim folder. The application loop polls and dispatches, the consumers are the
+ * 			shared state of the example and an event counter in place of the UART.
+ */
+
+/** Libraries **/
+#include "xgpio.h"
+#include "GpioEvents.h"
+#include "Benchmark.h"
+#include <stdlib.h>
+
+/** Definitions **/
+#define COALESCE_TICKS 	10
+
+/** Hardware Instances **/
+static XGpio switches;
+
+/** Global Variables **/
+static uint32_t 		simTime 	= 0;
+static uint32_t 		eventCount 	= 0;
+static GpioSharedState 	sharedState;
+
+static uint32_t SimClock()
+{
+	return simTime;
+}
+
+static void CountEvent(const GpioEvent& event, void* arguments)
+{
+	++eventCount;
+}
+
+// A single pass of the application loop
+static void Step(const uint32_t time)
+{
+	simTime = time;
+
+	GpioEventsPoll();
+	GpioEventsDispatch();
+}
+
+int main()
+{
+	XGpio_Initialize(&switches, 0);
+
+	if(!GpioEventsInit(&switches, 1, SimClock, COALESCE_TICKS) ||
+	   !GpioEventsSubscribe(GpioSharedStateConsumer, &sharedState) ||
+	   !GpioEventsSubscribe(CountEvent, nullptr))
+		return 1;
+
+	// Nothing changes, the cost of the polling loop
+	BenchmarkRun("gpio_poll_idle", 1000000, [](uint32_t) { Step(simTime + 1); });
+
+	// A clean edge per pass, each one is published
+	BenchmarkRun("gpio_update", 500000, [](uint32_t idx) {
+		GpioSimSetInputs(&switches, 1, idx & 0xF);
+		Step(simTime + COALESCE_TICKS + 1);
+	});
+
+	// A bouncing switch, the burst is merged into the leading edge and then settles
+	BenchmarkRun("gpio_bounce_burst", 100000, [](uint32_t idx) {
+		const uint32_t settled = (idx & 1) ? 0x1 : 0x0;
+
+		for(uint32_t bounce = 0; bounce < 4; ++bounce)
+		{
+			GpioSimSetInputs(&switches, 1, (bounce & 1) ? settled : (settled ^ 0x1));
+			Step(simTime + 1);
+		}
+
+		GpioSimSetInputs(&switches, 1, settled);
+		Step(simTime + COALESCE_TICKS + 1);
+	});
+
+	BenchmarkKeep(eventCount);
+
+	return (0 == eventCount) ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file 	SharedExchangeBench.cpp
+ * @brief	Data exchange between the processors through the shared memory.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Built with the exchange functions of the SharedBram example.
+ *
+ * @note	The SharedBram example passes a single byte through the BRAM, the ZynqAmp example
+ * 			passes sample blocks through the lock-free queue in the OCM. Both sides run in a
+ * 			single thread here, so the numbers are the instruction and barrier cost of an
+ * 			exchange without the coherency traffic between the cores. The AXI GPIOs of the
+ * 			SharedBram example are simulated by the HostSim of the MicroblazeDDR example.
+ */
+
+/** Libraries **/
+#include "AmpApplication.h"
+#include "SharedBramExchange.h"
+#include "Benchmark.h"
+
+/** Hardware Instances **/
+static XGpio switches;
+static XGpio leds;
+
+/** Global Variables **/
+static volatile uint8_t 				sharedBram[16];		// Stands for the shared BRAM
+static AmpQueue<AmpBlock, AMP_QUEUE_DEPTH> 	blocks;				// Zero initialized, i.e. empty queue
+
+int main()
+{
+	XGpio_Initialize(&switches, 0);
+	XGpio_Initialize(&leds, 1);
+
+	// Switch values published by the Microblaze, shown on the LEDs by the Cortex-A9
+	// A single exchange is too short to be timed reliably, an operation is a batch of them
+	BenchmarkRun("shared_bram_byte_x64", 1000000, [](uint32_t idx) {
+		for(uint8_t exchange = 0; exchange < 64; ++exchange)
+		{
+			GpioSimSetInputs(&switches, 1, uint8_t(idx + exchange));
+
+			SharedBramPublishSwitches(&switches, sharedBram);
+			SharedBramShowSwitches(&leds, sharedBram);
+		}
+
+		BenchmarkKeep(leds.outputs[0]);
+	});
+
+	// Blocks copied in and out of the queue
+	BenchmarkRun("shared_queue_copy", 1000000, [](uint32_t idx) {
+		static AmpBlock block;
+
+		block.sequence 	= idx;
+		block.count 	= AMP_BLOCK_SAMPLES;
+		blocks.Push(block);
+
+		blocks.Pop(block);
+		BenchmarkKeep(block);
+	});
+
+	// Blocks filled and consumed in place, as both cores of the AMP example do
+	BenchmarkRun("shared_queue_in_place", 1000000, [](uint32_t idx) {
+		AmpBlock* const slot = blocks.Claim();
+
+		slot->sequence 	= idx;
+		slot->count 	= AMP_BLOCK_SAMPLES;
+		for(uint16_t sample = 0; sample < AMP_BLOCK_SAMPLES; ++sample)
+			slot->samples[sample] = uint16_t(idx + sample);
+
+		blocks.Commit();
+
+		const AmpBlock* const block = blocks.Peek();
+
+		uint32_t sum = 0;
+		for(uint16_t sample = 0; sample < block->count; ++sample)
+			sum += block->samples[sample];
+
+		blocks.Release();
+		BenchmarkKeep(sum);
+	});
+
+	// The last value must have reached the LEDs
+	const bool b_exchanged = (leds.outputs[0] == switches.data[0]);
+
+	return (b_exchanged && (0 == blocks.Overflows())) ? 0 : 1;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file 	TraceBench.cpp
+ * @brief	Cost of the trace statements of the GPIO, TTC and DMA examples.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The paths of the examples that carry trace statements are built three times: with
+ * 			the statements removed by hand, with the statements of a module compiled out and
+ * 			with the statements compiled in but rejected by the runtime ceiling. The first
+ * 			two must be the same code, thus each of them is placed in a section of its own
+ * 			and the sizes of the sections are compared. The benchmark fails if they differ,
+ * 			the cases give the cycles of all three.
+ *
+ * 			The sizes are only compared on ELF hosts with the optimization enabled, the linker
+ * 			provides the bounds of the sections there.
+ */
+
+/** Libraries **/
+#include "xgpiops.h"
+#include "xdmaps.h"
+#include "DmaTransfer.h"
+#include "MemoryPool.h"
+#include "DeferredLog.h"
+#include "Trace.h"
+#include "Benchmark.h"
+#include <stdlib.h>
+
+/** Definitions **/
+#define PIN_JE7		0
+#define PIN_JE8		9
+#define PIN_JE9		14
+#define PIN_JE10	15
+
+#define OCM_ARENA_SIZE 		(62 * 1024)
+#define DDR_ARENA_SIZE 		(1024 * 1024)
+#define BUFFER_SIZE 		128			// As the DMA example
+
+#define LOG_FORMATS(FORMAT)																\
+	FORMAT(LOG_INPUTS, "JE7 is %u, JE8 is %u, JE9 is %u, JE10 is %u\r\n")				\
+	FORMAT(LOG_JE7_RISING_EDGE, "JE7 Rising Edge IRQ occurred!\r\n")					\
+	FORMAT(LOG_EVENT, "Event!\n")
+
+DLOG_DEFINE_FORMATS(LOG_FORMATS)
+
+TRACE_MODULE(TraceOff, TRACE_LEVEL_OFF)				// As a release build compiles the examples
+TRACE_MODULE(TraceOn, TRACE_LEVEL_VERBOSE)			// Everything compiled in, the ceiling filters
+
+#if defined(__ELF__) && defined(__OPTIMIZE__)
+#define TRACE_BENCH_SIZES
+#endif
+
+// Places a function alone in the named section, never inlined into the benchmark
+#define TRACE_BENCH_FUNCTION(name) 		__attribute__((noinline, noclone, section(#name))) static
+
+// Bounds of a section, defined by the linker
+#define TRACE_BENCH_SECTION(name) 		extern "C" const uint8_t __start_##name[], __stop_##name[];
+#define TRACE_BENCH_SIZE(name) 			size_t(__stop_##name - __start_##name)
+
+/** Hardware Instances **/
+static XGpioPs 	gpio;
+static XDmaPs 	dma;
+
+/** Global Variables **/
+static volatile bool 	b_gpioIrqFlag 		= false;
+static volatile bool 	b_timerTtc0Expired 	= false;
+static volatile uint32_t sinkBytes 			= 0;
+static uint32_t 		transferCount 		= 0;
+static uint8_t* 		sourceBuffer 		= nullptr;
+static uint8_t* 		destBuffer 			= nullptr;
+
+// Low level output of the standalone BSP
+extern "C" void outbyte(char c)
+{
+	sinkBytes = sinkBytes + 1;
+}
+
+/** Paths of the Examples **/
+// LogInput() of the ZynqPsGpio example
+template<typename Module>
+__attribute__((always_inline)) static inline void GpioLogInput()
+{
+	TRACE_DEFERRED(Module, TRACE_LEVEL_INFO, LOG_INPUTS,
+				   XGpioPs_ReadPin(&gpio, PIN_JE7),
+				   XGpioPs_ReadPin(&gpio, PIN_JE8),
+				   XGpioPs_ReadPin(&gpio, PIN_JE9),
+				   XGpioPs_ReadPin(&gpio, PIN_JE10));
+
+	if(b_gpioIrqFlag)
+	{
+		b_gpioIrqFlag = false;
+
+		TRACE_DEFERRED(Module, TRACE_LEVEL_INFO, LOG_JE7_RISING_EDGE);
+	}
+}
+
+// Timer event of the ZynqTripleTimerCounter loop
+template<typename Module>
+__attribute__((always_inline)) static inline void TtcEvent()
+{
+	b_timerTtc0Expired = false;
+
+	TRACE_DEFERRED(Module, TRACE_LEVEL_INFO, LOG_EVENT);
+}
+
+// Application loop of the ZynqPsDma example
+template<typename Module>
+__attribute__((always_inline)) static inline void DmaLoop()
+{
+	if(!DmaLoopStep(&dma, sourceBuffer, destBuffer, BUFFER_SIZE))
+	{
+		TRACE(Module, TRACE_LEVEL_ERROR, "Transfer %u failed!\n", unsigned(transferCount));
+		exit(1);
+	}
+
+	++transferCount;
+
+	TRACE(Module, TRACE_LEVEL_VERBOSE, "Transfer %u completed\n", unsigned(transferCount));
+}
+
+/** Measured Functions **/
+TRACE_BENCH_FUNCTION(trace_gpio_untraced) void GpioUntraced()
+{
+	if(b_gpioIrqFlag)
+	{
+		b_gpioIrqFlag = false;
+	}
+}
+
+TRACE_BENCH_FUNCTION(trace_gpio_compiled_out) void GpioCompiledOut() 	{ GpioLogInput<TraceOff>(); }
+TRACE_BENCH_FUNCTION(trace_gpio_ceiling) void GpioCeiling() 			{ GpioLogInput<TraceOn>(); }
+
+TRACE_BENCH_FUNCTION(trace_ttc_untraced) void TtcUntraced()
+{
+	b_timerTtc0Expired = false;
+}
+
+TRACE_BENCH_FUNCTION(trace_ttc_compiled_out) void TtcCompiledOut() 		{ TtcEvent<TraceOff>(); }
+TRACE_BENCH_FUNCTION(trace_ttc_ceiling) void TtcCeiling() 				{ TtcEvent<TraceOn>(); }
+
+TRACE_BENCH_FUNCTION(trace_dma_untraced) void DmaUntraced()
+{
+	if(!DmaLoopStep(&dma, sourceBuffer, destBuffer, BUFFER_SIZE))
+		exit(1);
+
+	++transferCount;
+}
+
+TRACE_BENCH_FUNCTION(trace_dma_compiled_out) void DmaCompiledOut() 		{ DmaLoop<TraceOff>(); }
+TRACE_BENCH_FUNCTION(trace_dma_ceiling) void DmaCeiling() 				{ DmaLoop<TraceOn>(); }
+
+#ifdef TRACE_BENCH_SIZES
+TRACE_BENCH_SECTION(trace_gpio_untraced)
+TRACE_BENCH_SECTION(trace_gpio_compiled_out)
+TRACE_BENCH_SECTION(trace_gpio_ceiling)
+TRACE_BENCH_SECTION(trace_ttc_untraced)
+TRACE_BENCH_SECTION(trace_ttc_compiled_out)
+TRACE_BENCH_SECTION(trace_ttc_ceiling)
+TRACE_BENCH_SECTION(trace_dma_untraced)
+TRACE_BENCH_SECTION(trace_dma_compiled_out)
+TRACE_BENCH_SECTION(trace_dma_ceiling)
+#endif
+
+/**
+ * @brief	Prints the code sizes of an example
+ * @return	False if the compiled out statements left any code behind
+ */
+static bool CompareSizes(const char* example, const size_t untraced, const size_t compiledOut, const size_t ceiling)
+{
+	printf("SIZE %s untraced %u compiled_out %u ceiling %u\n", example, unsigned(untraced), unsigned(compiledOut), unsigned(ceiling));
+
+	if(untraced != compiledOut)
+	{
+		printf("Compiled out trace statements of %s left code behind!\n", example);
+		return false;
+	}
+
+	return true;
+}
+
+int main()
+{
+	memoryFast.Init("OCM", malloc(OCM_ARENA_SIZE), OCM_ARENA_SIZE);
+	memoryBulk.Init("DDR", malloc(DDR_ARENA_SIZE), DDR_ARENA_SIZE);
+
+	sourceBuffer 	= memoryBulk.Allocate<uint8_t>(BUFFER_SIZE);
+	destBuffer 		= memoryFast.Allocate<uint8_t>(BUFFER_SIZE);
+
+	if((nullptr == sourceBuffer) || (nullptr == destBuffer) || !DmaTransferInit(memoryFast))
+		return 1;
+
+	if(XST_SUCCESS != XDmaPs_SetDoneHandler(&dma, 0, DmaDoneHandler, nullptr))
+		return 1;
+
+	for(size_t idx = 0; idx < BUFFER_SIZE; ++idx)
+		sourceBuffer[idx] = uint8_t(idx);
+
+	if(!DmaStart(&dma, sourceBuffer, destBuffer, BUFFER_SIZE))
+		return 1;
+
+	bool b_sizesMatch = true;
+
+#ifdef TRACE_BENCH_SIZES
+	b_sizesMatch &= CompareSizes("gpio", TRACE_BENCH_SIZE(trace_gpio_untraced), TRACE_BENCH_SIZE(trace_gpio_compiled_out), TRACE_BENCH_SIZE(trace_gpio_ceiling));
+	b_sizesMatch &= CompareSizes("ttc", TRACE_BENCH_SIZE(trace_ttc_untraced), TRACE_BENCH_SIZE(trace_ttc_compiled_out), TRACE_BENCH_SIZE(trace_ttc_ceiling));
+	b_sizesMatch &= CompareSizes("dma", TRACE_BENCH_SIZE(trace_dma_untraced), TRACE_BENCH_SIZE(trace_dma_compiled_out), TRACE_BENCH_SIZE(trace_dma_ceiling));
+#else
+	printf("Code sizes are not compared, build an optimized ELF binary\n");
+#endif
+
+	// Every statement compiled in is rejected at runtime
+	TraceSetCeiling(TRACE_LEVEL_OFF);
+
+	// An interrupt every other pass
+	BenchmarkRun("trace_gpio_untraced", 10000000, [](uint32_t idx) 		{ b_gpioIrqFlag = (idx & 1); GpioUntraced(); });
+	BenchmarkRun("trace_gpio_compiled_out", 10000000, [](uint32_t idx) 	{ b_gpioIrqFlag = (idx & 1); GpioCompiledOut(); });
+	BenchmarkRun("trace_gpio_ceiling", 10000000, [](uint32_t idx) 		{ b_gpioIrqFlag = (idx & 1); GpioCeiling(); });
+
+	BenchmarkRun("trace_ttc_untraced", 10000000, [](uint32_t) 			{ b_timerTtc0Expired = true; TtcUntraced(); });
+	BenchmarkRun("trace_ttc_compiled_out", 10000000, [](uint32_t) 		{ b_timerTtc0Expired = true; TtcCompiledOut(); });
+	BenchmarkRun("trace_ttc_ceiling", 10000000, [](uint32_t) 			{ b_timerTtc0Expired = true; TtcCeiling(); });
+
+	BenchmarkRun("trace_dma_untraced", 200000, [](uint32_t) 			{ DmaUntraced(); });
+	BenchmarkRun("trace_dma_compiled_out", 200000, [](uint32_t) 		{ DmaCompiledOut(); });
+	BenchmarkRun("trace_dma_ceiling", 200000, [](uint32_t) 				{ DmaCeiling(); });
+
+	// Nothing may have been logged or printed
+	DeferredLogFlush();
+
+	return (b_sizesMatch && (0 == sinkBytes)) ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file 	TtcEventBench.cpp
+ * @brief	Timer setup and event logging paths of the ZynqTripleTimerCounter example.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Timer setup of the example added.
+ *
+ * @note	The timer setup of the example (TtcSetup.cpp) is built as is against the simulated
+ * 			timers, both of its timers are set up as the main does. What the example repeats
+ * 			at each timer event is the deferred log record and its flush, the flushed bytes go
+ * 			into a counting sink instead of the UART.
+ */
+
+/** Libraries **/
+#include "xttcps.h"
+#include "TtcSetup.h"
+#include "DeferredLog.h"
+#include "Trace.h"
+#include "Benchmark.h"
+#include <stdlib.h>
+
+/** Definitions **/
+#define LOG_FORMATS(FORMAT)											\
+	FORMAT(LOG_EVENT, "Event!\n")									\
+	FORMAT(LOG_INTERVAL, "Interval %u, prescaler %u, match %u at %f\n")
+
+DLOG_DEFINE_FORMATS(LOG_FORMATS)
+
+TRACE_MODULE(TraceTtc, TRACE_LEVEL_INFO)
+
+/** Hardware Instances **/
+static XTtcPs timerTtc0;
+static XTtcPs timerTtc1;
+
+/** Global Variables **/
+static volatile uint32_t sinkBytes = 0;
+
+// Low level output of the standalone BSP
+extern "C" void outbyte(char c)
+{
+	sinkBytes = sinkBytes + 1;
+}
+
+int main()
+{
+	// Periodic event generation, 1Hz needs the prescaler
+	BenchmarkRun("ttc_setup_interval", 1000000, [](uint32_t) {
+		TmrCntrSetup setup;
+		setup.frequency = 1;
+		setup.options 	= XTTCPS_OPTION_INTERVAL_MODE | XTTCPS_OPTION_WAVE_DISABLE;
+
+		if(!TtcSetupInterval(&timerTtc0, 0, setup))
+			exit(1);
+
+		BenchmarkKeep(setup);
+	});
+
+	// PWM signal generation, 1kHz with a duty cycle of 63%
+	BenchmarkRun("ttc_setup_pwm", 1000000, [](uint32_t) {
+		TmrPwmSetup setup;
+		setup.frequency = 1000;
+		setup.options 	= XTTCPS_OPTION_INTERVAL_MODE | XTTCPS_OPTION_MATCH_MODE | XTTCPS_OPTION_WAVE_POLARITY;
+
+		if(!TtcSetupPwm(&timerTtc1, 1, setup, 0.63))
+			exit(1);
+
+		BenchmarkKeep(setup);
+	});
+
+	// The application loop of the example, a record per timer event and the flush while waiting
+	BenchmarkRun("ttc_event_log", 1000000, [](uint32_t) {
+		TRACE_DEFERRED(TraceTtc, TRACE_LEVEL_INFO, LOG_EVENT);
+		DeferredLogFlush();
+	});
+
+	// Records with the largest argument count
+	BenchmarkRun("ttc_event_log_4args", 1000000, [](uint32_t idx) {
+		TRACE_DEFERRED(TraceTtc, TRACE_LEVEL_INFO, LOG_INTERVAL, idx, 3u, 0xA1u, 0.63f);
+		DeferredLogFlush();
+	});
+
+	// A burst of events logged from the ISR before the loop flushes them
+	BenchmarkRun("ttc_event_log_burst", 100000, [](uint32_t idx) {
+		for(uint32_t event = 0; event < (DLOG_BUFFER_SIZE / 2); ++event)
+			TRACE_DEFERRED(TraceTtc, TRACE_LEVEL_INFO, LOG_INTERVAL, idx, event);
+
+		DeferredLogFlush();
+	});
+
+	return (0 == DeferredLogDropped()) ? 0 : 1;
+}
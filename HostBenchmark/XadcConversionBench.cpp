@@ -0,0 +1,159 @@
+/**
+ * @file 	XadcConversionBench.cpp
+ * @brief	Acquisition, conversion and processing path of the ZedboardXadc example.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Accuracy check of the fixed-point conversion.
+ * 			October 19, 2026 -> Register model of the host simulations used.
+ *
+ * @note	The acquisition, calibration, DSP and telemetry sources are built as is, the XADC
+ * 			is the register model of the host simulations. The float conversion of the BSP is
+ * 			measured as a reference. The host has no NEON, thus the scalar conversion loop is
+ * 			the one measured.
+ *
+ * 			Before the timing, every code of every channel is converted with the nominal
+ * 			transfer functions and compared with the exact result (UG480). The benchmark fails
+ * 			if a channel deviates by more than an eighth of its resolution, so that a faster
+ * 			conversion can't trade away its accuracy unnoticed.
+ */
+
+/** Libraries **/
+#include "xadcps.h"
+#include "XadcAcquisition.h"
+#include "XadcCalibration.h"
+#include "XadcDsp.h"
+#include "Telemetry.h"
+#include "Benchmark.h"
+#include <math.h>
+
+/** Definitions **/
+#define BLOCK_SIZE 		1024
+#define CODE_COUNT 		4096
+#define MAX_ERROR_LSB 	0.125	// Allowed deviation in the resolution of the channel
+
+/** Hardware Instances **/
+static XAdcPs 		adc;
+static XScuTimer 	timer;
+
+/** Global Variables **/
+static uint16_t 	raw[BLOCK_SIZE];
+static int32_t 		converted[BLOCK_SIZE];
+static float 		reference[BLOCK_SIZE];
+
+/**
+ * @brief	Converts all codes of each channel with the nominal transfer functions
+ * @return	false if a result deviates from the exact one more than allowed
+ */
+static bool CheckAccuracy()
+{
+	static uint16_t codes[CODE_COUNT];
+	static int32_t 	results[CODE_COUNT];
+
+	for(size_t code = 0; code < CODE_COUNT; ++code)
+		codes[code] = uint16_t(code << 4);
+
+	XadcCalibLoadDefaults();
+
+	bool b_accurate = true;
+
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+	{
+		// Micro-volts per code, milli-degrees Celsius for the temperature
+		double unitsPerCode = 3000000.0 / CODE_COUNT;
+		double offset 		= 0;
+
+		if(XADC_IDX_TEMP == idx)
+		{
+			unitsPerCode 	= 503975.0 / CODE_COUNT;
+			offset 			= -273150.0;
+		}
+		else if(XADC_IDX_VPVN == idx)
+		{
+			unitsPerCode 	= 1000000.0 / CODE_COUNT;
+		}
+
+		XadcConvertBlock(XadcChannelIndex(idx), codes, results, CODE_COUNT);
+
+		double maxError = 0;
+		for(size_t code = 0; code < CODE_COUNT; ++code)
+			maxError = fmax(maxError, fabs(results[code] - ((code * unitsPerCode) + offset)));
+
+		const double maxErrorLsb = maxError / unitsPerCode;
+
+		printf("ACCURACY channel %u max error %.1f (%.4f LSB)\n", unsigned(idx), maxError, maxErrorLsb);
+
+		if(maxErrorLsb > MAX_ERROR_LSB)
+			b_accurate = false;
+	}
+
+	return b_accurate;
+}
+
+int main()
+{
+	if(!CheckAccuracy())
+	{
+		printf("Fixed-point conversion is not accurate enough!\n");
+		return 1;
+	}
+
+	// Coefficients in the range of a real device
+	adc.calibration[XADCPS_CALIB_SUPPLY_OFFSET_COEFF] 	= 0xFFD0;
+	adc.calibration[XADCPS_CALIB_ADC_OFFSET_COEFF] 		= 0x0020;
+	adc.calibration[XADCPS_CALIB_GAIN_ERROR_COEFF] 		= 0x0043;
+
+	XadcCalibLoadFromDevice(&adc);
+	XadcAcqInit(&adc);
+
+	// A mid-scale result in each status register, the sequencer isn't simulated
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		XAdcPsSimSetCode(&adc, xadcChannels[idx], uint16_t(0x800 + idx));
+
+	// A timer tick: all channels read in a single pass, then drained by the application
+	BenchmarkRun("xadc_sequence_read", 200000, [](uint32_t) {
+		XadcAcqIrqHandler(&timer);
+
+		uint16_t sample = 0;
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+			XadcAcqRead(XadcChannelIndex(idx), &sample, 1);
+
+		BenchmarkKeep(sample);
+	});
+
+	// Ramp over all codes, MSB justified
+	for(size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+		raw[idx] = uint16_t(((idx * 4) & 0xFFF) << 4);
+
+	BenchmarkRun("xadc_convert_block", 20000, [](uint32_t) {
+		XadcConvertBlock(XADC_IDX_VCCINT, raw, converted, BLOCK_SIZE);
+		BenchmarkKeep(converted);
+	});
+
+	BenchmarkRun("xadc_float_convert_block", 20000, [](uint32_t) {
+		for(size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+			reference[idx] = XAdcPs_RawToVoltage(raw[idx]);
+
+		BenchmarkKeep(reference);
+	});
+
+	BenchmarkRun("xadc_dsp_block", 20000, [](uint32_t) {
+		XadcDspProcess(XADC_IDX_VCCINT, converted, BLOCK_SIZE);
+	});
+
+	BenchmarkKeep(XadcDspTakeSummary(XADC_IDX_VCCINT));
+
+	// Largest frame of raw samples, as the example streams them
+	BenchmarkRun("xadc_telemetry_frame", 200000, [](uint32_t idx) {
+		static TelemetrySamples 	samples;
+		static TelemetryFrameBuffer frame;
+
+		samples.channel = XADC_IDX_VCCINT;
+		samples.count 	= TELEMETRY_MAX_SAMPLES;
+		for(uint8_t sample = 0; sample < TELEMETRY_MAX_SAMPLES; ++sample)
+			samples.samples[sample] = raw[(idx + sample) & (BLOCK_SIZE - 1)];
+
+		BenchmarkKeep(TelemetryEncodeSamples(frame, idx, samples));
+	});
+
+	return 0;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file 	GpioEvents.cpp
+ * @brief	Change driven event pipeline on top of an AXI GPIO input channel.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "GpioEvents.h"
+#include "RingBuffer.h"
+#include "HotSection.h"
+
+#if defined(__MICROBLAZE__)
+#include "xil_cache.h"
+#endif
+
+/** Custom Structures **/
+struct GpioCapture{
+	uint32_t timestamp;
+	uint32_t value;
+};
+
+struct GpioSubscriber{
+	GpioConsumer 	consumer;
+	void* 			arguments;
+};
+
+/** Global Variables **/
+// Capture stage, written by the interrupt handler
+HOT_DATA static RingBuffer<GpioCapture, GPIO_EVENTS_CAPTURE_DEPTH> captures;
+HOT_DATA static uint32_t lastCaptured = 0;
+
+static XGpio* 				p_gpio 			= nullptr;
+static unsigned 			gpioChannel 	= 1;
+static uint32_t 			channelMask 	= XGPIO_IR_CH1_MASK;
+static GpioClock 			clock 			= nullptr;
+static uint32_t 			softTicks 		= 0;		// Dispatch calls, if there is no clock
+static uint32_t 			coalesceTicks 	= 0;
+
+// Coalesce and publish stages, application context only
+static uint32_t 			publishedValue 	= 0;
+static bool 				b_burstOpen 	= false;
+static GpioCapture 			burstStart 		= {0, 0};
+static GpioCapture 			burstLast 		= {0, 0};
+static uint16_t 			burstCount 		= 0;		// Captures after the leading one
+static uint32_t 			seenOverflows 	= 0;
+
+static GpioSubscriber 		subscribers[GPIO_EVENTS_MAX_CONSUMERS];
+static uint8_t 				subscriberCount = 0;
+static GpioEventStatistics 	statistics;
+
+static uint32_t Now()
+{
+	return (nullptr != clock) ? clock() : softTicks;
+}
+
+/**
+ * @brief	Passes the delta since the previous event to the consumers
+ * @return	Number of published events, zero if nothing changed
+ */
+static size_t Publish(const GpioCapture& capture, const uint16_t merged)
+{
+	const uint32_t changed = capture.value ^ publishedValue;
+
+	if(0 == changed)
+	{
+		++statistics.suppressed;
+		return 0;
+	}
+
+	const GpioEvent event{capture.timestamp, Now() - capture.timestamp, capture.value, changed, merged};
+
+	publishedValue = capture.value;
+	++statistics.published;
+
+	for(uint8_t idx = 0; idx < subscriberCount; ++idx)
+		subscribers[idx].consumer(event, subscribers[idx].arguments);
+
+	return 1;
+}
+
+static size_t CloseBurst()
+{
+	b_burstOpen = false;
+
+	// The leading edge is already out, only the settled value may differ
+	return (0 == burstCount) ? 0 : Publish(burstLast, burstCount);
+}
+
+static size_t Process(const GpioCapture& capture)
+{
+	size_t events = 0;
+
+	// A capture after the window starts a new burst, the previous one is closed first
+	if(b_burstOpen && ((capture.timestamp - burstStart.timestamp) >= coalesceTicks))
+		events += CloseBurst();
+
+	if(!b_burstOpen)
+	{
+		// Leading edge is published right away, the consumers don't wait for the window
+		b_burstOpen = true;
+		burstStart 	= capture;
+		burstLast 	= capture;
+		burstCount 	= 0;
+
+		events += Publish(capture, 1);
+	}
+	else
+	{
+		burstLast = capture;
+		++burstCount;
+		++statistics.coalesced;
+	}
+
+	return events;
+}
+
+bool GpioEventsInit(XGpio* gpio, unsigned channel, GpioClock gpioClock, uint32_t coalesceWindow)
+{
+	if((nullptr == gpio) || ((1 != channel) && (2 != channel)))
+		return false;
+
+	p_gpio 			= gpio;
+	gpioChannel 	= channel;
+	channelMask 	= (1 == channel) ? XGPIO_IR_CH1_MASK : XGPIO_IR_CH2_MASK;
+	clock 			= gpioClock;
+	coalesceTicks 	= coalesceWindow;
+
+	// The initial state is the reference of the first delta
+	lastCaptured 	= XGpio_DiscreteRead(p_gpio, gpioChannel);
+	publishedValue 	= lastCaptured;
+
+#ifdef GPIO_USE_INTERRUPT
+	XGpio_InterruptClear(p_gpio, channelMask);
+	XGpio_InterruptEnable(p_gpio, channelMask);
+	XGpio_InterruptGlobalEnable(p_gpio);
+#endif
+
+	return true;
+}
+
+bool GpioEventsSubscribe(GpioConsumer consumer, void* arguments)
+{
+	if((nullptr == consumer) || (subscriberCount >= GPIO_EVENTS_MAX_CONSUMERS))
+		return false;
+
+	subscribers[subscriberCount++] = GpioSubscriber{consumer, arguments};
+
+	return true;
+}
+
+HOT_CODE void GpioEventsIrqHandler(void* arguments)
+{
+	const uint32_t value = XGpio_DiscreteRead(p_gpio, gpioChannel);
+
+#ifdef GPIO_USE_INTERRUPT
+	XGpio_InterruptClear(p_gpio, channelMask);
+#endif
+
+	// The interrupt fires on any input transition, even if it is reverted before this read
+	if(value == lastCaptured)
+		return;
+
+	lastCaptured = value;
+
+	if(captures.Push(GpioCapture{Now(), value}))
+		++statistics.captured;
+}
+
+void GpioEventsPoll()
+{
+#ifndef GPIO_USE_INTERRUPT
+	if(nullptr != p_gpio)
+		GpioEventsIrqHandler(p_gpio);
+#endif
+}
+
+size_t GpioEventsDispatch()
+{
+	size_t events = 0;
+	GpioCapture capture;
+
+	if(nullptr == clock)
+		++softTicks;
+
+	while(captures.Pop(capture))
+		events += Process(capture);
+
+	// Lost captures may hide the latest value, take it from the channel directly
+	const uint32_t overflows = captures.Overflows();
+	if(overflows != seenOverflows)
+	{
+		seenOverflows = overflows;
+		events += Process(GpioCapture{Now(), XGpio_DiscreteRead(p_gpio, gpioChannel)});
+	}
+
+	if(b_burstOpen && ((Now() - burstStart.timestamp) >= coalesceTicks))
+		events += CloseBurst();
+
+	return events;
+}
+
+GpioEventStatistics GpioEventsGetStatistics()
+{
+	GpioEventStatistics copy = statistics;
+	copy.overflows = captures.Overflows();
+
+	return copy;
+}
+
+void GpioSharedStateConsumer(const GpioEvent& event, void* arguments)
+{
+	GpioSharedState* const state = static_cast<GpioSharedState*>(arguments);
+
+	// Readers retry while the sequence is odd or changes during their read
+	++state->sequence;
+	RING_BUFFER_BARRIER();
+
+	state->value 		= event.value;
+	state->timestamp 	= event.timestamp;
+	++state->events;
+
+	RING_BUFFER_BARRIER();
+	++state->sequence;
+
+#if defined(__MICROBLAZE__)
+	// The data cache is write-back, other bus masters read the memory
+	Xil_DCacheFlushRange(UINTPTR(state), sizeof(GpioSharedState));
+#endif
+}
@@ -0,0 +1,78 @@
+/**
+ * @file 	GpioEvents.h
+ * @brief	Change driven event pipeline on top of an AXI GPIO input channel.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The pipeline has three stages:
+ * 			- Capture: GpioEventsIrqHandler() reads the channel along with a timestamp and
+ * 			  queues it if the value differs from the previous capture. It is the channel
+ * 			  interrupt handler, or called by GpioEventsPoll() if there is no interrupt.
+ * 			- Coalesce: The first capture of a burst is published at once. Captures closer than
+ * 			  the coalescing window to it are merged, a bouncing switch results in a single event.
+ * 			- Publish: GpioEventsDispatch() passes the delta since the previous event to all
+ * 			  subscribed consumers. When the window ends, the settled value is published only
+ * 			  if it differs from the leading edge.
+ *
+ * 			If the capture queue overflows, the dispatch reads the channel once more so that
+ * 			the consumers always end up with the latest value.
+ *
+ * 			The block design of this example has neither an interrupt controller nor the
+ * 			interrupt output of the GPIO connected. Without them, the application loop calls
+ * 			GpioEventsPoll(), which samples the data register and feeds the same capture path.
+ * 			Once the GPIO interrupt (C_INTERRUPT_PRESENT) is connected to an AXI INTC, define
+ * 			GPIO_USE_INTERRUPT so that the channel interrupt is enabled and polling is skipped.
+ *
+ * 			Timestamps are taken from the clock given to GpioEventsInit(). Without an AXI Timer,
+ * 			pass nullptr and the ticks are counted in dispatch calls instead.
+ *
+ * 			The capture path builds for the host with the simulated AXI GPIO in HostSim.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xgpio.h"
+
+/** Definitions **/
+#define GPIO_EVENTS_CAPTURE_DEPTH 	16		// Must be a power of two
+#define GPIO_EVENTS_MAX_CONSUMERS 	4
+
+/** Custom Structures **/
+struct GpioEvent{
+	uint32_t timestamp;		// Of the capture being published
+	uint32_t latency;		// Ticks from the capture to the publication
+	uint32_t value;			// Value of the channel
+	uint32_t changed;		// Bits that differ from the previous event
+	uint16_t captures;		// Number of captures merged into this event
+};
+
+struct GpioEventStatistics{
+	uint32_t captured 	= 0;
+	uint32_t published 	= 0;
+	uint32_t coalesced 	= 0;	// Captures merged into another one
+	uint32_t suppressed = 0;	// Bursts that settled at the published value
+	uint32_t overflows 	= 0;	// Captures lost due to a full queue
+};
+
+typedef uint32_t (*GpioClock)();
+typedef void (*GpioConsumer)(const GpioEvent& event, void* arguments);
+
+// Latest state for another processor or a bus master, guarded by a sequence counter
+struct GpioSharedState{
+	volatile uint32_t sequence;		// Odd while being updated
+	volatile uint32_t value;
+	volatile uint32_t timestamp;
+	volatile uint32_t events;
+};
+
+/** Function Declarations **/
+bool 	GpioEventsInit(XGpio* gpio, unsigned channel, GpioClock clock, uint32_t coalesceTicks);
+bool 	GpioEventsSubscribe(GpioConsumer consumer, void* arguments);
+void 	GpioEventsIrqHandler(void* arguments);				// Channel interrupt handler, capture stage
+void 	GpioEventsPoll();									// Must be called periodically if the interrupt is not used
+size_t 	GpioEventsDispatch();								// Publishes the settled bursts, returns the event count
+GpioEventStatistics GpioEventsGetStatistics();
+
+// Ready made consumer, arguments is the GpioSharedState to be updated
+void 	GpioSharedStateConsumer(const GpioEvent& event, void* arguments);
@@ -0,0 +1,128 @@
+/**
+ * @file 	GpioEventsSim.cpp
+ * @brief	Host simulation of the GPIO event pipeline with scripted switch bounces.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Build from the MicroblazeDDR folder, add -DGPIO_USE_INTERRUPT for the interrupt driven variant:
+ * 			g++ -ISwProject/HostSim -I../Common/HostSim -I../Common SwProject/GpioEvents.cpp SwProject/HostSim/GpioEventsSim.cpp -o gpiosim
+ */
+
+/** Libraries **/
+#include "xgpio.h"
+#include "../GpioEvents.h"
+#include "SimCheck.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define COALESCE_TICKS 	10
+#define MAX_EVENTS 		16
+
+/** Hardware Instances **/
+static XGpio switches;
+
+/** Global Variables **/
+static uint32_t 		simTime = 0;
+static GpioEvent 		events[MAX_EVENTS];
+static size_t 			eventCount = 0;
+static GpioSharedState 	sharedState;
+
+static uint32_t SimClock()
+{
+	return simTime;
+}
+
+static void RecordEvent(const GpioEvent& event, void* arguments)
+{
+	if(eventCount < MAX_EVENTS)
+		events[eventCount++] = event;
+}
+
+// Changes the inputs at the given time, the application loop runs once afterwards
+static void Step(const uint32_t time, const uint32_t value)
+{
+	simTime = time;
+	GpioSimSetInputs(&switches, 1, value);
+	GpioEventsPoll();
+	GpioEventsDispatch();
+}
+
+static void Idle(const uint32_t time)
+{
+	simTime = time;
+	GpioEventsPoll();
+	GpioEventsDispatch();
+}
+
+int main()
+{
+	XGpio_Initialize(&switches, 0);
+	GpioSimSetInputs(&switches, 1, 0x3);
+	GpioSimConnect(&switches, GpioEventsIrqHandler, &switches);
+
+	if(!GpioEventsInit(&switches, 1, SimClock, COALESCE_TICKS))
+		return 1;
+
+	GpioEventsSubscribe(RecordEvent, nullptr);
+	GpioEventsSubscribe(GpioSharedStateConsumer, &sharedState);
+
+#ifdef GPIO_USE_INTERRUPT
+	printf("GPIO event pipeline, interrupt driven:\n");
+#else
+	printf("GPIO event pipeline, polled:\n");
+#endif
+
+	// Initial state is the reference, nothing to publish
+	Idle(0);
+	Check("initial state is not an event", 0 == eventCount);
+
+	// A clean press is published at once
+	Step(100, 0x2);
+	Check("leading edge published without delay", (1 == eventCount) && (0 == events[0].latency));
+	Check("delta holds the changed bit only", (0x2 == events[0].value) && (0x1 == events[0].changed));
+
+	// Bouncing release settles at the new value
+	Step(200, 0x3);
+	Step(201, 0x2);
+	Step(202, 0x3);
+	Step(204, 0x2);
+	Step(205, 0x3);
+	Check("bounces inside the window are held back", 2 == eventCount);
+	Idle(215);
+	Check("burst settled at the leading value is dropped", 2 == eventCount);
+	Check("leading edge of the burst published", (0x3 == events[1].value) && (1 == events[1].captures));
+
+	// Glitch that settles back at the previous value
+	Step(300, 0x1);
+	Step(303, 0x3);
+	Idle(312);
+	Check("settled value corrects the leading edge", (4 == eventCount) && (0x3 == events[3].value));
+	Check("correction reports the merged captures", (1 == events[3].captures) && (0x2 == events[3].changed));
+
+	// Inputs change faster than the dispatch, the queue overflows
+	simTime = 400;
+	for(uint32_t idx = 0; idx < 2 * GPIO_EVENTS_CAPTURE_DEPTH; ++idx)
+	{
+		GpioSimSetInputs(&switches, 1, idx & 0x3);
+		GpioEventsPoll();
+	}
+
+	GpioSimSetInputs(&switches, 1, 0x0);
+	GpioEventsPoll();
+	Idle(401);
+	Idle(420);
+
+	const GpioEventStatistics stats = GpioEventsGetStatistics();
+	Check("overflow detected", 0 != stats.overflows);
+	Check("latest value recovered after an overflow", (eventCount > 4) && (0x0 == events[eventCount - 1].value));
+
+	// Shared memory consumer
+	Check("shared state is consistent", (0 == (sharedState.sequence & 1)) && (0x0 == sharedState.value));
+	Check("shared state counts every event", sharedState.events == stats.published);
+
+	printf("  captured %u, published %u, coalesced %u, suppressed %u, overflows %u, register reads %u\n",
+			unsigned(stats.captured), unsigned(stats.published), unsigned(stats.coalesced),
+			unsigned(stats.suppressed), unsigned(stats.overflows), unsigned(switches.reads));
+
+	return SimCheckResult();
+}
@@ -0,0 +1,280 @@
+/**
+ * @file 	UartThroughputSim.cpp
+ * @brief	Throughput and processor load of the blocking UART path and of the ring buffered driver.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The driver layer is built as is on top of the simulated UART Lite. The application
+ * 			loop of the example is modeled by a fixed amount of work per iteration, the messages
+ * 			are the 6-byte switch messages carrying a sequence number. The blocking path sends
+ * 			them with XUartLite_SendByte() as xil_printf() does, the ring path queues them with a
+ * 			single UartWriteBatch() call and feeds the UART with UartPoll() or the interrupt.
+ *
+ * 			The processor load is the time spent in the register accesses of the UART, busy
+ * 			waits included, plus a modeled cost of the driver calls and of copying the bytes
+ * 			into the ring. Build from the MicroblazeDDR folder, add -DUART_USE_INTERRUPT for the
+ * 			interrupt driven variant:
+ * 			g++ -ISwProject/HostSim -I../Common/HostSim -I../Common SwProject/UartDriver.cpp SwProject/HostSim/UartThroughputSim.cpp -o uartsim
+ */
+
+/** Libraries **/
+#include "xuartlite.h"
+#include "../UartDriver.h"
+#include "SimCheck.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define CYCLES_PER_MS 		(UART_SIM_CPU_HZ / 1000)
+#define LOOP_CYCLES 		2000		// Rest of the application loop, 20us
+#define CALL_CYCLES 		20			// Call and return of a driver function
+#define COPY_CYCLES 		4			// Copy of a byte into the ring
+#define WINDOW_MS 			1000
+#define MESSAGE_SIZE 		6
+#define MAX_MESSAGES 		16			// In a single call
+#define LINE_RATE 			(double(UART_SIM_CPU_HZ) / UART_SIM_BYTE_CYCLES)	// Bytes per second
+
+/** Custom Structures **/
+enum SendPath{
+	PATH_BLOCKING,
+	PATH_RING
+};
+
+struct Workload{
+	uint32_t messages;		// Offered at once
+	uint32_t periodMs;
+};
+
+struct RunResult{
+	double 		bytesPerSecond 	= 0;
+	double 		load 			= 0;	// Share of the processor time spent for the UART
+	uint64_t 	longestLoop 	= 0;	// Cycles of the longest loop iteration
+	uint32_t 	offered 		= 0;	// Messages
+	uint32_t 	queued 			= 0;
+	uint32_t 	delivered 		= 0;
+	bool 		b_wellFormed 	= true;	// Whole messages on the wire, in order
+	bool 		b_gapless 		= true;	// No message missing
+};
+
+/** Hardware Instances **/
+static XUartLite uart;
+
+/** Global Variables **/
+static uint8_t 	messages[MAX_MESSAGES][MESSAGE_SIZE];
+static uint32_t sequence 	= 0;
+static uint64_t copyCycles 	= 0;
+
+static uint64_t Now()
+{
+	return UartSimState().now;
+}
+
+// Four digits of the sequence number and the line end
+static void Compose(uint8_t (&message)[MESSAGE_SIZE], uint32_t number)
+{
+	for(int idx = 3; idx >= 0; --idx)
+	{
+		message[idx] = uint8_t('0' + (number % 10));
+		number /= 10;
+	}
+
+	message[4] = '\r';
+	message[5] = '\n';
+}
+
+static uint32_t Send(const SendPath path, const uint32_t count)
+{
+	for(uint32_t idx = 0; idx < count; ++idx)
+		Compose(messages[idx], sequence++);
+
+	if(PATH_BLOCKING == path)
+	{
+		for(uint32_t idx = 0; idx < count; ++idx)
+		{
+			copyCycles += CALL_CYCLES;
+
+			for(const uint8_t byte : messages[idx])
+				XUartLite_SendByte(uart.RegBaseAddress, byte);
+		}
+
+		return count;
+	}
+
+	UartMessage batch[MAX_MESSAGES];
+	for(uint32_t idx = 0; idx < count; ++idx)
+		batch[idx] = UartMessage{messages[idx], MESSAGE_SIZE};
+
+	const uint32_t queued = UartWriteBatch(batch, count);
+
+	copyCycles += CALL_CYCLES + (COPY_CYCLES * MESSAGE_SIZE * queued);
+	UartSimAdvance(CALL_CYCLES + (COPY_CYCLES * MESSAGE_SIZE * queued));
+
+	return queued;
+}
+
+static void Poll()
+{
+#ifndef UART_USE_INTERRUPT
+	copyCycles += CALL_CYCLES;
+	UartSimAdvance(CALL_CYCLES);
+#endif
+
+	UartPoll();
+}
+
+/**
+ * @brief	Checks the messages on the wire since the given byte
+ * @param	result	Well formed and gapless flags are cleared on a mismatch, the delivered messages are counted
+ */
+static void CheckWire(const uint32_t wireStart, const uint32_t firstSequence, RunResult& result)
+{
+	const UartSim& sim = UartSimState();
+	uint32_t expected = firstSequence % 10000;
+
+	for(uint32_t offset = wireStart; (offset + MESSAGE_SIZE) <= sim.wireBytes; offset += MESSAGE_SIZE)
+	{
+		uint32_t number = 0;
+
+		for(uint32_t idx = 0; idx < 4; ++idx)
+		{
+			const uint8_t digit = sim.wire[(offset + idx) % UART_SIM_WIRE_SIZE];
+
+			if((digit < '0') || (digit > '9'))
+				result.b_wellFormed = false;
+
+			number = (number * 10) + (digit - '0');
+		}
+
+		if(('\r' != sim.wire[(offset + 4) % UART_SIM_WIRE_SIZE]) || ('\n' != sim.wire[(offset + 5) % UART_SIM_WIRE_SIZE]))
+			result.b_wellFormed = false;
+
+		// Later messages may be missing, never an earlier one coming back
+		const uint32_t skipped = (number + 10000 - expected) % 10000;
+
+		if(skipped > (sequence - firstSequence))
+			result.b_wellFormed = false;
+		else if(0 != skipped)
+			result.b_gapless = false;
+
+		expected = (number + 1) % 10000;
+		++result.delivered;
+	}
+
+	if(0 != ((sim.wireBytes - wireStart) % MESSAGE_SIZE))
+		result.b_wellFormed = false;
+}
+
+static RunResult Run(const SendPath path, const Workload& workload)
+{
+	const UartSim& sim = UartSimState();
+	RunResult result;
+
+	const uint32_t firstSequence = sequence;
+	const uint32_t wireStart 	= sim.wireBytes;
+	const uint64_t busStart 	= sim.busCycles;
+	const uint64_t start 		= Now();
+	const uint64_t end 			= start + (uint64_t(WINDOW_MS) * CYCLES_PER_MS);
+
+	copyCycles = 0;
+
+	uint64_t nextOffer 	= start;
+	uint64_t lastLoop 	= start;
+
+	while(Now() < end)
+	{
+		const uint64_t loop = Now() - lastLoop;
+		if(loop > result.longestLoop)
+			result.longestLoop = loop;
+
+		lastLoop = Now();
+
+		UartSimAdvance(LOOP_CYCLES);
+
+		if(Now() >= nextOffer)
+		{
+			result.offered 	+= workload.messages;
+			result.queued 	+= Send(path, workload.messages);
+			nextOffer 		+= uint64_t(workload.periodMs) * CYCLES_PER_MS;
+		}
+
+		if(PATH_RING == path)
+			Poll();
+	}
+
+	// A blocking send may end after the window
+	const double elapsed = double(Now() - start);
+
+	result.bytesPerSecond 	= double(sim.wireBytes - wireStart) * UART_SIM_CPU_HZ / elapsed;
+	result.load 			= double((sim.busCycles - busStart) + copyCycles) / elapsed;
+
+	// Everything queued leaves the wire before the next run
+	while(!UartIsIdle() || !UartSimIsIdle())
+	{
+		UartSimAdvance(LOOP_CYCLES);
+		UartPoll();
+	}
+
+	CheckWire(wireStart, firstSequence, result);
+
+	printf("  %-9s %6.0f B/s, load %5.1f%%, longest loop %7.1f us, %u/%u messages sent\n", (PATH_BLOCKING == path) ? "blocking" : "ring",
+		   result.bytesPerSecond, result.load * 100, double(result.longestLoop) * 1000000 / UART_SIM_CPU_HZ,
+		   unsigned(result.delivered), unsigned(result.offered));
+
+	return result;
+}
+
+static void CheckBursts()
+{
+	printf("Bursts of 16 messages every 50ms:\n");
+
+	const Workload workload{16, 50};
+	const RunResult blocking 	= Run(PATH_BLOCKING, workload);
+	const RunResult ring 		= Run(PATH_RING, workload);
+
+	// All but a FIFO and a shift register of each burst is waited for
+	const uint64_t burstWait = uint64_t((workload.messages * MESSAGE_SIZE) - UART_SIM_FIFO_DEPTH - 1) * UART_SIM_BYTE_CYCLES;
+
+	Check("every message delivered in order", blocking.b_wellFormed && blocking.b_gapless && (blocking.delivered == blocking.offered) &&
+											  ring.b_wellFormed && ring.b_gapless && (ring.delivered == ring.offered));
+	Check("blocking path stalls the loop for the burst", blocking.longestLoop >= burstWait);
+	Check("ring path never waits for the wire", ring.longestLoop < UART_SIM_BYTE_CYCLES);
+	Check("ring path takes a fraction of the load", (ring.load * 4) < blocking.load);
+}
+
+static void CheckSaturation()
+{
+	printf("Twice the line rate offered, 4 messages every 1ms:\n");
+
+	const Workload workload{4, 1};
+	const UartStatistics before = UartGetStatistics();
+
+	const RunResult blocking 	= Run(PATH_BLOCKING, workload);
+	const RunResult ring 		= Run(PATH_RING, workload);
+
+	const UartStatistics after = UartGetStatistics();
+
+	Check("both paths keep the line busy", (blocking.bytesPerSecond > (0.99 * LINE_RATE)) && (ring.bytesPerSecond > (0.99 * LINE_RATE)));
+	Check("blocking path spends the loop on the UART", blocking.load > 0.9);
+	Check("ring path load stays low", ring.load < 0.05);
+	Check("ring path drops whole messages only", ring.b_wellFormed && !ring.b_gapless && (ring.delivered == ring.queued));
+	Check("dropped bytes counted", ((ring.offered - ring.queued) * MESSAGE_SIZE) == (after.bytesDropped - before.bytesDropped));
+}
+
+int main()
+{
+	if(XST_SUCCESS != XUartLite_Initialize(&uart, 0))
+		return 1;
+
+	UartSimConnect(&uart, UartIrqHandler, &uart);
+	UartInit(&uart);
+
+#ifdef UART_USE_INTERRUPT
+	printf("UART driver, interrupt driven:\n");
+#else
+	printf("UART driver, polled:\n");
+#endif
+
+	CheckBursts();
+	CheckSaturation();
+
+	return SimCheckResult();
+}
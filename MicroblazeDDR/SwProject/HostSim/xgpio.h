@@ -0,0 +1,84 @@
+/**
+ * @file 	xgpio.h
+ * @brief	Simulated AXI GPIO driver for building the GPIO event pipeline on a host.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Output register added for the shared BRAM benchmark.
+ * 			October 19, 2026 -> Basic types taken from Common/HostSim.
+ *
+ * @note	Only the part of the XGpio API used by GpioEvents and the shared BRAM exchange is
+ * 			provided. The channel inputs are driven with GpioSimSetInputs(). An input change
+ * 			sets the channel bit of the interrupt status register and, if the interrupt is
+ * 			enabled like the real core does, calls the handler connected with GpioSimConnect()
+ * 			as the interrupt controller would.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Definitions **/
+#define XGPIO_IR_CH1_MASK 	0x1
+#define XGPIO_IR_CH2_MASK 	0x2
+
+/** Custom Structures **/
+struct XGpio{
+	u32 	data[2];			// Input value of each channel
+	u32 	outputs[2];			// Output value of each channel
+	u32 	interruptEnable;	// IP IER
+	u32 	interruptStatus;	// IP ISR
+	bool 	b_globalEnable;		// GIER
+	void 	(*handler)(void*);
+	void* 	arguments;
+	u32 	reads;				// Data register reads, to see the cost of polling
+};
+
+/** Driver API **/
+static inline int XGpio_Initialize(XGpio* gpio, u16 deviceId)
+{
+	*gpio = XGpio{{0, 0}, {0, 0}, 0, 0, false, nullptr, nullptr, 0};
+
+	return XST_SUCCESS;
+}
+
+static inline u32 XGpio_DiscreteRead(XGpio* gpio, unsigned channel)
+{
+	++gpio->reads;
+
+	return gpio->data[channel - 1];
+}
+
+static inline void XGpio_DiscreteWrite(XGpio* gpio, unsigned channel, u32 value)
+{
+	gpio->outputs[channel - 1] = value;
+}
+
+static inline void 	XGpio_InterruptEnable(XGpio* gpio, u32 mask) 	{ gpio->interruptEnable |= mask; 	}
+static inline void 	XGpio_InterruptDisable(XGpio* gpio, u32 mask) 	{ gpio->interruptEnable &= ~mask; 	}
+static inline void 	XGpio_InterruptGlobalEnable(XGpio* gpio) 		{ gpio->b_globalEnable = true; 		}
+static inline void 	XGpio_InterruptGlobalDisable(XGpio* gpio) 		{ gpio->b_globalEnable = false; 	}
+static inline u32 	XGpio_InterruptGetStatus(XGpio* gpio) 			{ return gpio->interruptStatus; 	}
+static inline void 	XGpio_InterruptClear(XGpio* gpio, u32 mask) 	{ gpio->interruptStatus &= ~mask; 	}
+
+/** Simulation Controls **/
+static inline void GpioSimConnect(XGpio* gpio, void (*handler)(void*), void* arguments)
+{
+	gpio->handler 	= handler;
+	gpio->arguments = arguments;
+}
+
+static inline void GpioSimSetInputs(XGpio* gpio, unsigned channel, u32 value)
+{
+	if(value == gpio->data[channel - 1])
+		return;
+
+	gpio->data[channel - 1] = value;
+
+	const u32 mask = (1 == channel) ? XGPIO_IR_CH1_MASK : XGPIO_IR_CH2_MASK;
+	gpio->interruptStatus |= mask;
+
+	// The interrupt output is the enabled status bits gated by the global enable
+	if(gpio->b_globalEnable && (0 != (gpio->interruptStatus & gpio->interruptEnable)) && (nullptr != gpio->handler))
+		gpio->handler(gpio->arguments);
+}
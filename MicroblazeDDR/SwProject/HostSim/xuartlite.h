@@ -0,0 +1,232 @@
+/**
+ * @file 	xuartlite.h
+ * @brief	Simulated AXI UART Lite for building the UART driver on a host.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> IRQ mask and basic types taken from Common/HostSim.
+ *
+ * @note	Time is counted in cycles of the 100MHz Microblaze and only moves when the model
+ * 			is accessed or UartSimAdvance() is called. Each register access costs the cycles of
+ * 			an AXI Lite access. The transmitter shifts a byte out of the 16-byte TX FIFO in the
+ * 			time of ten bits at 115200 baud, the bytes that leave the wire are captured.
+ *
+ * 			As the real core, the interrupt is raised when the TX FIFO becomes empty and
+ * 			only if it's enabled. The handler connected with UartSimConnect() is called at
+ * 			once, or when Xil_ExceptionEnable() unmasks the interrupts. The bus cycles of all
+ * 			accesses are counted, including the status reads of a busy wait, to tell how much
+ * 			of the processor time the UART takes. Only the part of the API used by the driver
+ * 			layer and the blocking send of the BSP is provided.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+#include "xil_exception.h"
+
+/** Definitions **/
+#define XUL_RX_FIFO_OFFSET 		0
+#define XUL_TX_FIFO_OFFSET 		4
+#define XUL_STATUS_REG_OFFSET 	8
+#define XUL_CONTROL_REG_OFFSET 	12
+
+#define XUL_SR_RX_FIFO_VALID_DATA 	0x01
+#define XUL_SR_TX_FIFO_EMPTY 		0x04
+#define XUL_SR_TX_FIFO_FULL 		0x08
+#define XUL_SR_INTR_ENABLED 		0x10
+#define XUL_CR_ENABLE_INTR 			0x10
+
+#define UART_SIM_CPU_HZ 		100000000
+#define UART_SIM_BAUD_RATE 		115200
+#define UART_SIM_BYTE_CYCLES 	((UART_SIM_CPU_HZ * 10ULL) / UART_SIM_BAUD_RATE)	// Start, 8 data and stop bits
+#define UART_SIM_ACCESS_CYCLES 	10			// AXI Lite register access
+#define UART_SIM_FIFO_DEPTH 	16
+#define UART_SIM_WIRE_SIZE 		65536		// Captured bytes, the older ones are overwritten
+
+/** Custom Structures **/
+struct UartSim{
+	// Core
+	u8 		txFifo[UART_SIM_FIFO_DEPTH];
+	u32 	txHead;
+	u32 	txCount;
+	bool 	b_shifting;				// A byte is being shifted out
+	u8 		shiftRegister;
+	uint64_t shiftEnd;				// Time the byte in the shift register leaves the wire
+	bool 	b_interruptEnabled;
+	bool 	b_interruptPending;
+
+	void 	(*handler)(void*);
+	void* 	arguments;
+	bool 	b_inHandler;
+
+	// Simulation
+	uint64_t now;
+	uint64_t busCycles;				// Spent in the register accesses
+	uint64_t handlerCycles;			// Spent in the handler, register accesses included
+	u32 	interrupts;
+	u8 		wire[UART_SIM_WIRE_SIZE];
+	u32 	wireBytes;
+};
+
+struct XUartLite{
+	UINTPTR RegBaseAddress;
+	u32 	IsReady;
+};
+
+/** Simulation State **/
+inline UartSim& UartSimState()
+{
+	static UartSim state;
+
+	return state;
+}
+
+// Stands for the interrupt controller, the UART is its only source
+static inline bool UartSimIrqLine()
+{
+	const UartSim& uart = UartSimState();
+
+	return uart.b_interruptPending && uart.b_interruptEnabled && !uart.b_inHandler && (nullptr != uart.handler);
+}
+
+static inline void UartSimServe()
+{
+	UartSim& uart = UartSimState();
+
+	if(ExceptionSimState().b_irqMasked || !UartSimIrqLine())
+		return;
+
+	uart.b_interruptPending = false;
+	uart.b_inHandler 		= true;
+	++uart.interrupts;
+
+	const uint64_t start = uart.now;
+	uart.handler(uart.arguments);
+	uart.handlerCycles += (uart.now - start);
+
+	uart.b_inHandler = false;
+}
+
+// Moves the transmitter to the current time
+static inline void UartSimUpdate()
+{
+	UartSim& uart = UartSimState();
+
+	while(uart.b_shifting && (uart.shiftEnd <= uart.now))
+	{
+		uart.wire[uart.wireBytes++ % UART_SIM_WIRE_SIZE] = uart.shiftRegister;
+		uart.b_shifting = false;
+
+		if(0 != uart.txCount)
+		{
+			// The next byte starts right after the previous one
+			uart.shiftRegister 	= uart.txFifo[uart.txHead];
+			uart.txHead 		= (uart.txHead + 1) % UART_SIM_FIFO_DEPTH;
+			uart.b_shifting 	= true;
+			uart.shiftEnd 		+= UART_SIM_BYTE_CYCLES;
+
+			if(0 == --uart.txCount)
+				uart.b_interruptPending |= uart.b_interruptEnabled;
+		}
+	}
+
+	UartSimServe();
+}
+
+static inline void UartSimAdvance(const uint64_t cycles)
+{
+	UartSimState().now += cycles;
+	UartSimUpdate();
+}
+
+static inline void UartSimAccess()
+{
+	UartSimState().busCycles += UART_SIM_ACCESS_CYCLES;
+	UartSimAdvance(UART_SIM_ACCESS_CYCLES);
+}
+
+static inline void UartSimConnect(XUartLite* uart, void (*handler)(void*), void* arguments)
+{
+	UartSimState().handler 		= handler;
+	UartSimState().arguments 	= arguments;
+	ExceptionSimState().irqLine 	= UartSimIrqLine;
+	ExceptionSimState().irqHandler 	= UartSimServe;
+}
+
+// Nothing queued, nothing on the wire
+static inline bool UartSimIsIdle()
+{
+	return (0 == UartSimState().txCount) && !UartSimState().b_shifting;
+}
+
+/** Driver API **/
+static inline int XUartLite_Initialize(XUartLite* uart, u16 deviceId)
+{
+	uart->RegBaseAddress 	= UINTPTR(&UartSimState());
+	uart->IsReady 			= 1;
+
+	return XST_SUCCESS;
+}
+
+static inline u32 XUartLite_ReadReg(UINTPTR baseAddress, u32 offset)
+{
+	UartSim& uart = *reinterpret_cast<UartSim*>(baseAddress);
+	UartSimAccess();
+
+	if(XUL_STATUS_REG_OFFSET == offset)
+	{
+		u32 status = uart.b_interruptEnabled ? XUL_SR_INTR_ENABLED : 0;
+
+		if(0 == uart.txCount)
+			status |= XUL_SR_TX_FIFO_EMPTY;
+
+		if(UART_SIM_FIFO_DEPTH == uart.txCount)
+			status |= XUL_SR_TX_FIFO_FULL;
+
+		return status;
+	}
+
+	// Nothing is ever received
+	return 0;
+}
+
+static inline void XUartLite_WriteReg(UINTPTR baseAddress, u32 offset, u32 data)
+{
+	UartSim& uart = *reinterpret_cast<UartSim*>(baseAddress);
+
+	if((XUL_TX_FIFO_OFFSET == offset) && (uart.txCount < UART_SIM_FIFO_DEPTH))
+	{
+		// An idle transmitter takes the byte at once, the FIFO becomes empty again
+		if(!uart.b_shifting)
+		{
+			uart.shiftRegister 	= u8(data);
+			uart.b_shifting 	= true;
+			uart.shiftEnd 		= uart.now + UART_SIM_BYTE_CYCLES;
+			uart.b_interruptPending |= uart.b_interruptEnabled;
+		}
+		else
+		{
+			uart.txFifo[(uart.txHead + uart.txCount++) % UART_SIM_FIFO_DEPTH] = u8(data);
+		}
+	}
+	else if(XUL_CONTROL_REG_OFFSET == offset)
+	{
+		uart.b_interruptEnabled = (0 != (data & XUL_CR_ENABLE_INTR));
+	}
+
+	UartSimAccess();
+}
+
+static inline u32 	XUartLite_GetStatusReg(UINTPTR baseAddress) 	{ return XUartLite_ReadReg(baseAddress, XUL_STATUS_REG_OFFSET); 							}
+static inline bool 	XUartLite_IsTransmitFull(UINTPTR baseAddress) 	{ return 0 != (XUartLite_GetStatusReg(baseAddress) & XUL_SR_TX_FIFO_FULL); 				}
+static inline bool 	XUartLite_IsReceiveEmpty(UINTPTR baseAddress) 	{ return 0 == (XUartLite_GetStatusReg(baseAddress) & XUL_SR_RX_FIFO_VALID_DATA); 			}
+static inline void 	XUartLite_EnableIntr(UINTPTR baseAddress) 		{ XUartLite_WriteReg(baseAddress, XUL_CONTROL_REG_OFFSET, XUL_CR_ENABLE_INTR); 			}
+static inline void 	XUartLite_DisableIntr(UINTPTR baseAddress) 		{ XUartLite_WriteReg(baseAddress, XUL_CONTROL_REG_OFFSET, 0); 							}
+
+// Blocking send of the BSP, outbyte() and xil_printf() use it
+static inline void XUartLite_SendByte(UINTPTR baseAddress, u8 data)
+{
+	while(XUartLite_IsTransmitFull(baseAddress));
+
+	XUartLite_WriteReg(baseAddress, XUL_TX_FIFO_OFFSET, data);
+}
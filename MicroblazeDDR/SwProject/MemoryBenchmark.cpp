@@ -0,0 +1,474 @@
+/**
+ * @file 	MemoryBenchmark.cpp
+ * @brief	Bandwidth and latency benchmarks for the LMB BRAM and the MIG DDR.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "MemoryBenchmark.h"
+
+#if defined(__MICROBLAZE__)
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "MemoryPool.h"
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+#include "xtmrctr.h"
+#endif
+#else
+#include <stdio.h>
+#include <chrono>
+#endif
+
+/** Definitions **/
+#if defined(__MICROBLAZE__)
+#define BENCH_PRINTF 		xil_printf
+#else
+#define BENCH_PRINTF 		printf
+#endif
+
+#define STREAM_SCALAR 		3
+
+static_assert(MEMBENCH_LINE_BYTES >= (2 * sizeof(uintptr_t)), "A chase node must fit into a cache line!");
+static_assert(0 == (MEMBENCH_LMB_BYTES % MEMBENCH_LINE_BYTES), "Region sizes must be multiples of the cache line!");
+static_assert(0 == (MEMBENCH_DDR_BYTES % MEMBENCH_LINE_BYTES), "Region sizes must be multiples of the cache line!");
+
+/** Custom Structures **/
+struct MemoryRegion{
+	const char* name;
+	uint8_t* 	base;
+	size_t 		bytes;
+};
+
+typedef void (*StreamKernel)(uint32_t* a, uint32_t* b, uint32_t* c, size_t count);
+
+struct StreamTest{
+	const char* 	name;
+	StreamKernel 	kernel;
+	uint8_t 		arrays;		// Arrays touched per element, read or written
+};
+
+/** Global Variables **/
+#if !defined(__MICROBLAZE__)
+alignas(MEMBENCH_LINE_BYTES) static uint32_t lmbArena[MEMBENCH_LMB_BYTES / sizeof(uint32_t)];
+alignas(MEMBENCH_LINE_BYTES) static uint32_t ddrArena[MEMBENCH_DDR_BYTES / sizeof(uint32_t)];
+#endif
+
+static volatile uintptr_t sink = 0;		// Keeps the results of the read-only tests alive
+static uint32_t randomState = 0x12345678;
+
+/** Time Base **/
+#if defined(__MICROBLAZE__)
+typedef uint32_t BenchTicks;
+
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+#define MEMBENCH_TIME_BASE 	"axi_timer"
+
+static XTmrCtr timer;
+
+static bool InitTimeBase()
+{
+	if(XTmrCtr_Initialize(&timer, XPAR_TMRCTR_0_DEVICE_ID) != XST_SUCCESS)
+		return false;
+
+	// Free running up counter
+	XTmrCtr_SetOptions(&timer, 0, XTC_AUTO_RELOAD_OPTION);
+	XTmrCtr_Start(&timer, 0);
+
+	return true;
+}
+
+static BenchTicks Now()
+{
+	return XTmrCtr_GetValue(&timer, 0);
+}
+
+static uint64_t TicksToNs(const BenchTicks ticks)
+{
+	return (uint64_t(ticks) * 1000000000ull) / XPAR_TMRCTR_0_CLOCK_FREQ_HZ;
+}
+#else
+#define MEMBENCH_TIME_BASE 	"none"
+
+static bool 		InitTimeBase() 						{ return false; }
+static BenchTicks 	Now() 								{ return 0; }
+static uint64_t 	TicksToNs(const BenchTicks ticks) 	{ return ticks; }
+#endif
+
+static void SettleCaches()
+{
+	// Dirty lines of the previous test must not be written back during the next one
+	Xil_DCacheFlush();
+}
+#else
+typedef uint64_t BenchTicks;
+
+#define MEMBENCH_TIME_BASE 	"steady_clock"
+
+static bool InitTimeBase()
+{
+	return true;
+}
+
+static BenchTicks Now()
+{
+	return BenchTicks(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint64_t TicksToNs(const BenchTicks ticks)
+{
+	return ticks;
+}
+
+static void SettleCaches()
+{
+	// Caches of the host are coherent and much larger, nothing to do
+}
+#endif
+
+/** STREAM Kernels **/
+static void __attribute__((noinline)) Copy(uint32_t* __restrict a, uint32_t* __restrict b, uint32_t* __restrict c, size_t count)
+{
+	for(size_t idx = 0; idx < count; ++idx)
+		c[idx] = a[idx];
+}
+
+static void __attribute__((noinline)) Scale(uint32_t* __restrict a, uint32_t* __restrict b, uint32_t* __restrict c, size_t count)
+{
+	for(size_t idx = 0; idx < count; ++idx)
+		b[idx] = STREAM_SCALAR * c[idx];
+}
+
+static void __attribute__((noinline)) Add(uint32_t* __restrict a, uint32_t* __restrict b, uint32_t* __restrict c, size_t count)
+{
+	for(size_t idx = 0; idx < count; ++idx)
+		c[idx] = a[idx] + b[idx];
+}
+
+static void __attribute__((noinline)) Triad(uint32_t* __restrict a, uint32_t* __restrict b, uint32_t* __restrict c, size_t count)
+{
+	for(size_t idx = 0; idx < count; ++idx)
+		a[idx] = b[idx] + STREAM_SCALAR * c[idx];
+}
+
+static const StreamTest streamTests[] = {
+	{"copy",  Copy,  2},
+	{"scale", Scale, 2},
+	{"add",   Add,   3},
+	{"triad", Triad, 3}
+};
+
+/** Helpers **/
+static uint32_t Random()
+{
+	// Xorshift, deterministic so that every run chases the very same cycle
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+
+	return randomState;
+}
+
+static uint64_t ElapsedNs(const BenchTicks start)
+{
+	return TicksToNs(BenchTicks(Now() - start));
+}
+
+/**
+ * @brief	Prints a single result line, values are given in thousandths
+ */
+static void PrintResult(const MemoryRegion& region, const char* test, size_t bytes, uint32_t parameter, uint64_t milliValue, const char* unit)
+{
+	BENCH_PRINTF("membench,%s,%s,%s,%d,%d,%d.%03d,%s\r\n",
+				 MEMBENCH_TARGET, region.name, test, int(bytes), int(parameter),
+				 int(milliValue / 1000), int(milliValue % 1000), unit);
+}
+
+static uint64_t MilliMBps(const uint64_t bytes, const uint64_t ns)
+{
+	return (0 == ns) ? 0 : (bytes * 1000000ull) / ns;
+}
+
+static uint64_t MilliNsPerAccess(const uint64_t ns, const uint64_t accesses)
+{
+	return (0 == accesses) ? 0 : (ns * 1000ull) / accesses;
+}
+
+/** Tests **/
+static void RunStream(const MemoryRegion& region)
+{
+	// Three equal arrays, each starting at a cache line
+	const size_t count = ((region.bytes / 3) / MEMBENCH_LINE_BYTES) * (MEMBENCH_LINE_BYTES / sizeof(uint32_t));
+
+	uint32_t* const a = reinterpret_cast<uint32_t*>(region.base);
+	uint32_t* const b = a + count;
+	uint32_t* const c = b + count;
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		a[idx] = 1;
+		b[idx] = 2;
+		c[idx] = 0;
+	}
+
+	for(const StreamTest& test : streamTests)
+	{
+		const size_t passBytes 	= count * sizeof(uint32_t) * test.arrays;
+		const size_t passes 	= (passBytes >= MEMBENCH_MIN_STREAM_BYTES) ? 1 : (MEMBENCH_MIN_STREAM_BYTES / passBytes);
+		uint64_t bestNs 		= UINT64_MAX;
+
+		for(uint8_t repeat = 0; repeat < MEMBENCH_REPEATS; ++repeat)
+		{
+			SettleCaches();
+
+			const BenchTicks start = Now();
+
+			for(size_t pass = 0; pass < passes; ++pass)
+				test.kernel(a, b, c, count);
+
+			const uint64_t ns = ElapsedNs(start);
+			if(ns < bestNs)
+				bestNs = ns;
+		}
+
+		PrintResult(region, test.name, count * sizeof(uint32_t), 0, MilliMBps(uint64_t(passBytes) * passes, bestNs), "MB/s");
+	}
+
+	// Every kernel only depends on the outputs of the previous ones, repeating it changes nothing
+	const uint32_t expectedC = 1 + STREAM_SCALAR * 1;
+	const uint32_t expectedB = STREAM_SCALAR * 1;
+	const uint32_t expectedA = expectedB + STREAM_SCALAR * expectedC;
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		if((expectedA != a[idx]) || (expectedB != b[idx]) || (expectedC != c[idx]))
+		{
+			BENCH_PRINTF("# %s stream validation failed at %d\r\n", region.name, int(idx));
+			break;
+		}
+	}
+}
+
+/**
+ * @brief	Links the cache lines of a working set into a single random cycle
+ * @return	First node of the cycle
+ *
+ * @note	The first word of a node points to the next node, the second word
+ * 			holds the visiting order while the cycle is built.
+ */
+static uintptr_t* BuildChain(uint8_t* base, const size_t nodes)
+{
+	auto Node = [base](const size_t index){ return reinterpret_cast<uintptr_t*>(base + (index * MEMBENCH_LINE_BYTES)); };
+
+	for(size_t idx = 0; idx < nodes; ++idx)
+		Node(idx)[1] = idx;
+
+	// Fisher-Yates shuffle of the visiting order
+	for(size_t idx = nodes - 1; idx > 0; --idx)
+	{
+		const size_t other 	= Random() % (idx + 1);
+		const uintptr_t tmp = Node(idx)[1];
+
+		Node(idx)[1] 	= Node(other)[1];
+		Node(other)[1] 	= tmp;
+	}
+
+	for(size_t idx = 0; idx < nodes; ++idx)
+	{
+		const size_t current 	= Node(idx)[1];
+		const size_t next 		= Node((idx + 1) % nodes)[1];
+
+		Node(current)[0] = reinterpret_cast<uintptr_t>(Node(next));
+	}
+
+	return Node(Node(0)[1]);
+}
+
+static uintptr_t* __attribute__((noinline)) Chase(uintptr_t* node, size_t steps)
+{
+	// Each load depends on the previous one, the latency can't be hidden
+	for(; steps >= 4; steps -= 4)
+	{
+		node = reinterpret_cast<uintptr_t*>(*node);
+		node = reinterpret_cast<uintptr_t*>(*node);
+		node = reinterpret_cast<uintptr_t*>(*node);
+		node = reinterpret_cast<uintptr_t*>(*node);
+	}
+
+	for(; steps > 0; --steps)
+		node = reinterpret_cast<uintptr_t*>(*node);
+
+	return node;
+}
+
+static void RunPointerChase(const MemoryRegion& region)
+{
+	for(size_t workingSet = 1024; workingSet <= region.bytes; workingSet *= 2)
+	{
+		const size_t nodes 	= workingSet / MEMBENCH_LINE_BYTES;
+		uintptr_t* node 	= BuildChain(region.base, nodes);
+		uint64_t bestNs 	= UINT64_MAX;
+
+		SettleCaches();
+
+		// Warm up, the working sets smaller than the cache should hit
+		node = Chase(node, nodes);
+
+		for(uint8_t repeat = 0; repeat < MEMBENCH_REPEATS; ++repeat)
+		{
+			const BenchTicks start = Now();
+			node = Chase(node, MEMBENCH_CHASE_STEPS);
+
+			const uint64_t ns = ElapsedNs(start);
+			if(ns < bestNs)
+				bestNs = ns;
+		}
+
+		sink = reinterpret_cast<uintptr_t>(node);
+
+		PrintResult(region, "chase", workingSet, MEMBENCH_LINE_BYTES, MilliNsPerAccess(bestNs, MEMBENCH_CHASE_STEPS), "ns");
+	}
+}
+
+/**
+ * @brief	Reads a word from each cache line of the buffer exactly once, in stride order
+ * @return	Number of reads
+ *
+ * @note	Strides shorter than a cache line read all words of the line instead.
+ */
+static size_t __attribute__((noinline)) StrideRead(const uint8_t* base, const size_t bytes, const size_t stride, uint32_t& sum)
+{
+	const size_t phaseEnd 	= (stride > MEMBENCH_LINE_BYTES) ? stride : 1;
+	size_t accesses 		= 0;
+
+	for(size_t phase = 0; phase < phaseEnd; phase += MEMBENCH_LINE_BYTES)
+	{
+		for(size_t offset = phase; offset < bytes; offset += stride)
+		{
+			sum += *reinterpret_cast<const uint32_t*>(base + offset);
+			++accesses;
+		}
+	}
+
+	return accesses;
+}
+
+static void RunStrideSweep(const MemoryRegion& region)
+{
+	for(size_t stride = sizeof(uint32_t); (stride <= MEMBENCH_MAX_STRIDE) && (stride < region.bytes); stride *= 2)
+	{
+		uint64_t bestNs 	= UINT64_MAX;
+		size_t accesses 	= 0;
+		uint32_t sum 		= 0;
+
+		for(uint8_t repeat = 0; repeat < MEMBENCH_REPEATS; ++repeat)
+		{
+			SettleCaches();
+
+			const BenchTicks start = Now();
+			size_t count = 0;
+
+			// Small regions are read several times to get above the timer resolution
+			do{
+				count += StrideRead(region.base, region.bytes, stride, sum);
+			}while(count < MEMBENCH_CHASE_STEPS);
+
+			const uint64_t ns = ElapsedNs(start);
+			if(ns < bestNs)
+				bestNs = ns;
+
+			accesses = count;
+		}
+
+		sink = sum;
+
+		PrintResult(region, "stride", region.bytes, uint32_t(stride), MilliNsPerAccess(bestNs, accesses), "ns");
+	}
+}
+
+/**
+ * @brief	Prints the header and runs all tests on the given regions
+ */
+static bool RunAll(const MemoryRegion* regions, const size_t count)
+{
+	BENCH_PRINTF("# membench target=%s timebase=%s line=%d repeats=%d\r\n",
+				 MEMBENCH_TARGET, MEMBENCH_TIME_BASE, int(MEMBENCH_LINE_BYTES), int(MEMBENCH_REPEATS));
+
+	if(!InitTimeBase())
+	{
+		BENCH_PRINTF("# No time base, add an AXI Timer to the block design to get the timings\r\n");
+		return false;
+	}
+
+	BENCH_PRINTF("# target,region,test,bytes,parameter,value,unit\r\n");
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		RunStream(regions[idx]);
+		RunPointerChase(regions[idx]);
+		RunStrideSweep(regions[idx]);
+	}
+
+	BENCH_PRINTF("# membench done\r\n");
+
+	return true;
+}
+
+bool MemBenchRun()
+{
+#if defined(__MICROBLAZE__)
+	// Buffers are borrowed from the arenas and given back at the end
+	const size_t fastMark = memoryFast.Mark();
+	const size_t bulkMark = memoryBulk.Mark();
+
+	size_t lmbBytes = memoryFast.Available();
+	lmbBytes = (lmbBytes > MEMBENCH_LMB_BYTES) ? MEMBENCH_LMB_BYTES : lmbBytes;
+	lmbBytes = (lmbBytes > MEMBENCH_LINE_BYTES) ? ((lmbBytes - MEMBENCH_LINE_BYTES) & ~size_t(MEMBENCH_LINE_BYTES - 1)) : 0;
+
+	uint8_t* const lmbBase = static_cast<uint8_t*>(memoryFast.Allocate(lmbBytes, MEMBENCH_LINE_BYTES));
+	uint8_t* const ddrBase = static_cast<uint8_t*>(memoryBulk.Allocate(MEMBENCH_DDR_BYTES, 4096));
+
+	bool b_success = false;
+
+	if(nullptr == ddrBase)
+	{
+		BENCH_PRINTF("# DDR arena doesn't have %d bytes\r\n", int(MEMBENCH_DDR_BYTES));
+	}
+	else if((nullptr == lmbBase) || (lmbBytes < 1024))
+	{
+		// The hot code and data of the application come first
+		BENCH_PRINTF("# Not enough free LMB, only DDR is measured\r\n");
+
+		const MemoryRegion regions[] = {{"DDR", ddrBase, MEMBENCH_DDR_BYTES}};
+		b_success = RunAll(regions, 1);
+	}
+	else
+	{
+		const MemoryRegion regions[] = {
+			{"LMB", lmbBase, lmbBytes},
+			{"DDR", ddrBase, MEMBENCH_DDR_BYTES}
+		};
+
+		b_success = RunAll(regions, 2);
+	}
+
+	memoryFast.Release(fastMark);
+	memoryBulk.Release(bulkMark);
+
+	return b_success;
+#else
+	const MemoryRegion regions[] = {
+		{"LMB", reinterpret_cast<uint8_t*>(lmbArena), MEMBENCH_LMB_BYTES},
+		{"DDR", reinterpret_cast<uint8_t*>(ddrArena), MEMBENCH_DDR_BYTES}
+	};
+
+	return RunAll(regions, 2);
+#endif
+}
+
+#if !defined(__MICROBLAZE__)
+int main()
+{
+	return MemBenchRun() ? 0 : 1;
+}
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file 	MemoryBenchmark.h
+ * @brief	Bandwidth and latency benchmarks for the LMB BRAM and the MIG DDR.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Three groups of tests are run on each memory region:
+ * 			- STREAM-like copy, scale, add and triad kernels on 32-bit words
+ * 			- Pointer chasing over a random cycle of cache lines for the load-to-use latency
+ * 			- Stride sweep, each cache line of a buffer is read once in the order given by the stride
+ *
+ * 			The same source builds for the host, so that the numbers can be compared with a PC:
+ * 				g++ -O2 SwProject/MemoryBenchmark.cpp -o membench
+ *
+ * 			The report is printed one result per line in CSV form:
+ * 				membench,<target>,<region>,<test>,<bytes>,<parameter>,<value>,<unit>
+ *
+ * 			On the Microblaze, the buffers are borrowed from the memory arenas, thus
+ * 			memoryFast and memoryBulk must be initialized before MemBenchRun() is called.
+ *
+ * 			The Microblaze has no cycle counter. Timings are taken from an AXI Timer, which
+ * 			the block design of this example doesn't have yet. Without one, MemBenchRun()
+ * 			only reports that there is no time base.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__MICROBLAZE__)
+#include "xparameters.h"
+#endif
+
+/** Definitions **/
+#if defined(__MICROBLAZE__)
+#define MEMBENCH_TARGET 			"microblaze"
+#define MEMBENCH_LINE_BYTES 		(XPAR_MICROBLAZE_DCACHE_LINE_LEN * 4)
+#define MEMBENCH_LMB_BYTES 			3840				// Upper limit, the free part of the fast arena is used
+#ifndef MEMBENCH_DDR_BYTES
+#define MEMBENCH_DDR_BYTES 			(4 * 1024 * 1024)	// 512 times the 8KB data cache
+#endif
+#else
+#define MEMBENCH_TARGET 			"host"
+#define MEMBENCH_LINE_BYTES 		64
+#define MEMBENCH_LMB_BYTES 			3840				// Same as the target, stays in L1
+#ifndef MEMBENCH_DDR_BYTES
+#define MEMBENCH_DDR_BYTES 			(128 * 1024 * 1024)	// Well beyond the last level cache
+#endif
+#endif
+
+#define MEMBENCH_MIN_STREAM_BYTES 	(1024 * 1024)		// Minimum traffic of a single measurement
+#define MEMBENCH_REPEATS 			5					// Best of, as STREAM does
+#define MEMBENCH_CHASE_STEPS 		(64 * 1024)
+#define MEMBENCH_MAX_STRIDE 		8192				// Covers the DDR3 row size
+
+/** Function Declarations **/
+bool MemBenchRun();		// Runs all tests and prints the report, returns false if there is no time base
@@ -0,0 +1,173 @@
+/**
+ * @file 	UartDriver.cpp
+ * @brief	Non-blocking, ring buffered driver layer on top of the AXI UART Lite.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Drain and fill paths placed into the LMB BRAM.
+ * 			October 19, 2026 -> In place writing into the TX ring added.
+ */
+
+/** Libraries **/
+#include "UartDriver.h"
+#include "xil_exception.h"
+#include "HotSection.h"
+
+/** Global Variables **/
+// Rings are ordinary globals, thus they are placed in DDR by the linker script
+static UartTxRing txRing;
+static RingBuffer<uint8_t, UART_RX_RING_SIZE> rxRing;
+
+static UINTPTR 			baseAddress = 0;
+static UartStatistics 	statistics;
+
+/**
+ * @brief	Moves bytes from the TX ring into the TX FIFO until one of them runs out
+ */
+HOT_CODE static void DrainTx()
+{
+	uint8_t byte = 0;
+
+	while(!XUartLite_IsTransmitFull(baseAddress) && txRing.Pop(byte))
+	{
+		XUartLite_WriteReg(baseAddress, XUL_TX_FIFO_OFFSET, byte);
+		++statistics.bytesSent;
+	}
+}
+
+/**
+ * @brief	Moves bytes from the RX FIFO into the RX ring
+ */
+HOT_CODE static void FillRx()
+{
+	while(!XUartLite_IsReceiveEmpty(baseAddress))
+	{
+		const uint8_t byte = uint8_t(XUartLite_ReadReg(baseAddress, XUL_RX_FIFO_OFFSET));
+
+		if(rxRing.Push(byte))
+			++statistics.bytesReceived;
+	}
+}
+
+/**
+ * @brief	Starts a transmission if the UART is not already busy with one
+ *
+ * @note	The TX interrupt of the UART Lite fires only when the TX FIFO becomes empty.
+ * 			If the FIFO is already empty when new data is queued, no interrupt will come,
+ * 			thus the writer primes the FIFO itself.
+ */
+static void KickTx()
+{
+#ifdef UART_USE_INTERRUPT
+	Xil_ExceptionDisable();
+
+	if(0 != (XUartLite_GetStatusReg(baseAddress) & XUL_SR_TX_FIFO_EMPTY))
+		DrainTx();
+
+	Xil_ExceptionEnable();
+#endif
+}
+
+static void UpdateHighWater()
+{
+	const uint32_t level = txRing.Size();
+
+	if(level > statistics.txHighWater)
+		statistics.txHighWater = level;
+}
+
+void UartInit(XUartLite* uart)
+{
+	if(nullptr == uart)
+		while(1);
+
+	baseAddress = uart->RegBaseAddress;
+
+#ifdef UART_USE_INTERRUPT
+	XUartLite_EnableIntr(baseAddress);
+#else
+	XUartLite_DisableIntr(baseAddress);
+#endif
+}
+
+size_t UartWrite(const uint8_t* data, size_t size)
+{
+	const size_t written = txRing.Write(data, size);
+
+	statistics.bytesQueued 	+= written;
+	statistics.bytesDropped += (size - written);
+
+	UpdateHighWater();
+	KickTx();
+
+	return written;
+}
+
+size_t UartWriteBatch(const UartMessage* messages, size_t count)
+{
+	size_t queued = 0;
+
+	for(; queued < count; ++queued)
+	{
+		const UartMessage& message = messages[queued];
+
+		// A message is either queued completely or not at all
+		if(message.size > txRing.Free())
+			break;
+
+		txRing.Write(message.data, message.size);
+		statistics.bytesQueued += message.size;
+	}
+
+	for(size_t idx = queued; idx < count; ++idx)
+		statistics.bytesDropped += messages[idx].size;
+
+	// Single kick for the whole batch
+	UpdateHighWater();
+	KickTx();
+
+	return queued;
+}
+
+UartTxRing& UartGetTxRing()
+{
+	return txRing;
+}
+
+void UartCommit(size_t size)
+{
+	// Staged bytes become visible to the drain at once
+	txRing.Commit(size);
+	statistics.bytesQueued += size;
+
+	UpdateHighWater();
+	KickTx();
+}
+
+size_t UartRead(uint8_t* data, size_t size)
+{
+	return rxRing.Read(data, size);
+}
+
+HOT_CODE void UartIrqHandler(void* arguments)
+{
+	FillRx();
+	DrainTx();
+}
+
+HOT_CODE void UartPoll()
+{
+#ifndef UART_USE_INTERRUPT
+	FillRx();
+	DrainTx();
+#endif
+}
+
+bool UartIsIdle()
+{
+	return txRing.IsEmpty();
+}
+
+UartStatistics UartGetStatistics()
+{
+	return statistics;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file 	UartDriver.h
+ * @brief	Non-blocking, ring buffered driver layer on top of the AXI UART Lite.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> In place writing into the TX ring added.
+ *
+ * @note	Writers only copy their data into the TX ring and return immediately. The ring is
+ * 			drained into the 16-byte TX FIFO of the UART by UartIrqHandler(). Received bytes
+ * 			are collected into the RX ring the same way.
+ *
+ * 			The block design of this example has no interrupt controller. Without one,
+ * 			the application loop calls UartPoll() instead, which does the very same work
+ * 			without ever waiting for the UART. Once an AXI INTC is added and the UART
+ * 			interrupt is connected, define UART_USE_INTERRUPT so that the driver primes the
+ * 			TX FIFO itself and relies on the interrupt for the rest.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xuartlite.h"
+#include "RingBuffer.h"
+
+/** Definitions **/
+#define UART_TX_RING_SIZE	2048	// Must be a power of two
+#define UART_RX_RING_SIZE	256		// Must be a power of two
+
+/** Custom Structures **/
+typedef RingBuffer<uint8_t, UART_TX_RING_SIZE> UartTxRing;
+
+struct UartMessage{
+	const uint8_t* 	data;
+	size_t 			size;
+};
+
+struct UartStatistics{
+	uint32_t bytesQueued 	= 0;	// Accepted by the write functions
+	uint32_t bytesSent 		= 0;	// Moved into the TX FIFO
+	uint32_t bytesDropped 	= 0;	// Rejected due to a full TX ring
+	uint32_t bytesReceived 	= 0;
+	uint32_t txHighWater 	= 0;	// Maximum TX ring level
+};
+
+/** Function Declarations **/
+void 	UartInit(XUartLite* uart);
+size_t 	UartWrite(const uint8_t* data, size_t size);					// Queues as many bytes as fit
+size_t 	UartWriteBatch(const UartMessage* messages, size_t count);		// Queues whole messages only, returns the queued message count
+UartTxRing& UartGetTxRing();											// For the writers staging their data in place, e.g. telemetry
+void 	UartCommit(size_t size);										// Publishes the bytes staged in the TX ring
+size_t 	UartRead(uint8_t* data, size_t size);
+void 	UartIrqHandler(void* arguments);								// UART interrupt handler
+void 	UartPoll();														// Must be called periodically if the interrupt is not used
+bool 	UartIsIdle();													// TX ring is empty
+UartStatistics UartGetStatistics();
@@ -3,6 +3,12 @@
  * @brief	Main source file for the Microblaze of the MIG example project.
  * @author	Caglayan DOKME, caglayandokme@gmail.com
  * @date	September 12, 2021 -> Created
+ * 			October 19, 2026 -> Non-blocking UART driver added.
+ * 			October 19, 2026 -> Memory benchmark added.
+ * 			October 19, 2026 -> Memory arenas added.
+ * 			October 19, 2026 -> Hot code placement report added.
+ * 			October 19, 2026 -> Switches are read through the GPIO event pipeline.
+ * 			October 19, 2026 -> Binary telemetry added.
  */
 
 /** Libraries **/
@@ -10,40 +16,184 @@
 #include "xuartlite.h"
 #include "xgpio.h"
 #include "sleep.h"
+#include "UartDriver.h"
+#include "MemoryBenchmark.h"
+#include "MemoryPool.h"
+#include "HotSection.h"
+#include "GpioEvents.h"
+#include "Telemetry.h"
+
+#if defined(UART_USE_INTERRUPT) || defined(GPIO_USE_INTERRUPT)
+#include "xintc.h"
+#endif
+
+// Interrupt IDs at the AXI INTC, modify them according to the block design
+#if defined(UART_USE_INTERRUPT) && !defined(UART_IRQ_ID)
+#define UART_IRQ_ID		XPAR_MICROBLAZE_0_AXI_INTC_UART_INTERRUPT_INTR
+#endif
+
+#if defined(GPIO_USE_INTERRUPT) && !defined(GPIO_IRQ_ID)
+#define GPIO_IRQ_ID		XPAR_MICROBLAZE_0_AXI_INTC_GPIO_IP2INTC_IRPT_INTR
+#endif
+
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+#include "xtmrctr.h"
+
+#define GPIO_CLOCK 				ReadTimer
+#define GPIO_COALESCE_TICKS 	(XPAR_TMRCTR_0_CLOCK_FREQ_HZ / 200)	// 5ms
+#else
+// Without a timer, the ticks are counted in application loop iterations
+#define GPIO_CLOCK 				nullptr
+#define GPIO_COALESCE_TICKS 	20000
+#endif
+
+/** Linker Script Symbols **/
+extern "C" uint8_t __lmb_bss_end, __lmb_end, _end;
 
 /** Hardware Instances **/
 XGpio switches;
 XUartLite uart;
 
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+XTmrCtr timer;
+#endif
+
+/** Global Variables **/
+// Latest switch state for the other bus masters
+GpioSharedState switchState;
+
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+uint32_t ReadTimer()
+{
+	return XTmrCtr_GetValue(&timer, 0);
+}
+
+void InitTimer()
+{
+	if(XTmrCtr_Initialize(&timer, XPAR_TMRCTR_0_DEVICE_ID) != XST_SUCCESS)
+		while(1);
+
+	// Free running
+	XTmrCtr_SetOptions(&timer, 0, XTC_AUTO_RELOAD_OPTION);
+	XTmrCtr_Start(&timer, 0);
+}
+#endif
+
+#if defined(UART_USE_INTERRUPT) || defined(GPIO_USE_INTERRUPT)
+XIntc intc;
+
+void InitIntc()
+{
+	if(XIntc_Initialize(&intc, XPAR_INTC_0_DEVICE_ID) != XST_SUCCESS)
+		while(1);
+
+#ifdef UART_USE_INTERRUPT
+	// Connect the UART driver's handler to the UART interrupt
+	if(XIntc_Connect(&intc, UART_IRQ_ID, Xil_ExceptionHandler(UartIrqHandler), &uart) != XST_SUCCESS)
+		while(1);
+#endif
+
+#ifdef GPIO_USE_INTERRUPT
+	// Capture stage of the event pipeline
+	if(XIntc_Connect(&intc, GPIO_IRQ_ID, Xil_ExceptionHandler(GpioEventsIrqHandler), &switches) != XST_SUCCESS)
+		while(1);
+#endif
+
+	if(XIntc_Start(&intc, XIN_REAL_MODE) != XST_SUCCESS)
+		while(1);
+
+#ifdef UART_USE_INTERRUPT
+	XIntc_Enable(&intc, UART_IRQ_ID);
+#endif
+
+#ifdef GPIO_USE_INTERRUPT
+	XIntc_Enable(&intc, GPIO_IRQ_ID);
+#endif
+
+	// Connect the interrupt controller to the interrupt input of the Microblaze
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XIntc_InterruptHandler), &intc);
+	Xil_ExceptionEnable();
+}
+#endif
+
+// Prints the new state of the switches
+void SwitchesToUart(const GpioEvent& event, void* arguments)
+{
+#ifdef TELEMETRY_BINARY
+	// Encoded straight into the TX ring, decode with Common/TelemetryDecoder.py
+	const TelemetrySwitches switchState{event.value, event.changed};
+
+	UartCommit(TelemetryEncode(UartGetTxRing(), TELEMETRY_SWITCHES, event.timestamp, &switchState, sizeof(switchState)));
+#else
+	uint8_t txBuffer[6] = {0, 0, 0, 0, '\r', '\n'};	// Message to be sent
+
+	// Write the values to corresponding character positions
+	// '0' : Conversion to ASCII
+	for(size_t idx = 0; idx < 4; ++idx)
+		txBuffer[idx] = '0' + (((event.value & (1 << idx)) == 0) ? 0 : 1);
+
+	// Only queued, the UART is fed in the background
+	UartWrite(txBuffer, sizeof(txBuffer));
+#endif
+}
+
+void InitMemory()
+{
+	// The part of the LMB BRAM that isn't used by the linker script
+	memoryFast.Init("LMB", &__lmb_bss_end, size_t(&__lmb_end - &__lmb_bss_end));
+
+	// The DDR above the stack
+	memoryBulk.Init("DDR", &_end, size_t((XPAR_MIG_7SERIES_0_HIGHADDR + 1) - reinterpret_cast<uintptr_t>(&_end)));
+}
+
 int main()
 {
 	/** Initialization **/
+	InitMemory();
+
 	if(XUartLite_Initialize(&uart, XPAR_UART_DEVICE_ID) != XST_SUCCESS)
 		while(1);
 
+	UartInit(&uart);
+
+#ifdef XPAR_TMRCTR_0_DEVICE_ID
+	InitTimer();
+#endif
+
+#if defined(UART_USE_INTERRUPT) || defined(GPIO_USE_INTERRUPT)
+	InitIntc();
+#endif
+
+#ifdef MEMORY_BENCHMARK
+	// Printed synchronously through the standard output before the application starts
+	MemBenchRun();
+	MemoryPrintReport();
+
+	const HotSymbol hotSymbols[] = {HOT_SYMBOL(UartPoll), HOT_SYMBOL(UartIrqHandler), HOT_SYMBOL(GpioEventsIrqHandler)};
+	HotPrintReport(hotSymbols, sizeof(hotSymbols) / sizeof(hotSymbols[0]));
+#endif
+
 	if(XGpio_Initialize(&switches, XPAR_GPIO_DEVICE_ID) != XST_SUCCESS)
 		while(1);
 
-	/** Variables **/
-	uint8_t swStatus, prevSwStatus;					// Status of the switches
-	uint8_t txBuffer[6] = {0, 0, 0, 0, '\r', '\n'};	// Message to be sent
+	// The current state is the reference, only the changes are published
+	if(!GpioEventsInit(&switches, 1, GPIO_CLOCK, GPIO_COALESCE_TICKS))
+		while(1);
+
+	GpioEventsSubscribe(SwitchesToUart, nullptr);
+	GpioEventsSubscribe(GpioSharedStateConsumer, &switchState);
 
 	while(1)
 	{
-		swStatus = XGpio_DiscreteRead(&switches, 1);
-
-		// Check if the value changed
-		if(swStatus != prevSwStatus)
-		{
-			prevSwStatus = swStatus;
+		// Sample the switches (no-op in interrupt mode)
+		GpioEventsPoll();
 
-			// Write the values to corresponding character positions
-			// '0' : Conversion to ASCII
-			for(size_t idx = 0; idx < 4; ++idx)
-				txBuffer[idx] = '0' + (((swStatus & (1 << idx)) == 0) ? 0 : 1);
+		// Publish the settled changes
+		GpioEventsDispatch();
 
-			XUartLite_Send(&uart, txBuffer, sizeof(txBuffer));
-		}
+		// Feed the UART without waiting for it (no-op in interrupt mode)
+		UartPoll();
 	}
 
 }
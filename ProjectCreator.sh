@@ -1,17 +1,346 @@
 #!/bin/bash
 # Brief     : This is a shell script file for invoking the Vivado and initially run a tickle file in it
 # Date      : September 19, 2020
+#           : October 19, 2026 -> Parallel batch mode added
+#           : October 19, 2026 -> Implementation and the artifact cache added to the batch mode
+#           : October 19, 2026 -> Batch jobs reaped by polling, bash 4 is enough
 # Note      : User must specify a valid tickle file name
 # Author    : Caglayan DOKME, caglayandokme@gmail.com
 # Usage     : User can either modify the script file to invoke the Vivado with a custom TCL file
 #           : or give the TCL file as an input argument(Better with full path)
 #           : The Vivado application version and installiation path can vary for hos devices
 #           : Therefore, it can also be given as an input or modified inside the script file
+# Batch     : All example projects (*/*HwProject/*.tcl except the block designs) are regenerated
+#           : headless, several Vivado instances run in parallel
+#           :   ./ProjectCreator.sh -b [-j jobs] [-o outputDir] [vivadoPath]
+#           : Each project is generated in its own working directory (outputDir/projectName) with
+#           : its own log. A timing summary is printed once all of them are completed.
+#           : Set VIVADO_BIN to use another Vivado executable, e.g. the stub on a PC without Vivado
+#           :   VIVADO_BIN=./VivadoStub.sh ./ProjectCreator.sh -b -j 4
+# Cache     : Each project is implemented and its bitstream (.bit) and hardware definition (.hdf)
+#           : are exported into its working directory. The artifacts are also stored in a cache
+#           : keyed on the hash of the tool version and the hardware project sources (the block
+#           : design, the project tickle file and the constraints). A project whose key is found
+#           : in the cache isn't regenerated, the cached artifacts are copied instead.
+#           :   ./ProjectCreator.sh -b [-c cacheDir] [-f]
+#           : The cache is kept in outputDir/.cache unless another one is given, -f ignores
+#           : the cached artifacts and regenerates all of the projects (The cache is refreshed).
 
 # User specified variables(Can be modified using the command line input arguments)
 tclfile=System.tcl                          # Main tickle file name to be used initially in Vivado
 vivadoPath=/tools/Xilinx/Vivado/2017.4      # Path of the Vivado in the host device
 
+# Batch mode variables(Can be modified using the command line options)
+batchJobs=$(nproc 2>/dev/null || echo 2)    # Number of Vivado instances running at the same time
+batchOutput=$(pwd)/_batch                   # Working directories and logs of the projects
+batchCache=""                               # Artifact cache, outputDir/.cache unless given
+batchForce=0                                # Regenerate the projects even if they are cached
+implJobs=2                                  # Vivado jobs of a single implementation run
+repoPath=$(cd "$(dirname "$0")" && pwd)     # Projects are searched under the directory of this script
+
+# Finds the project tickle files, the block design scripts are sourced by them
+findProjects() {
+    local tcl
+
+    for tcl in "$repoPath"/*/*HwProject/*.tcl; do
+        if [ "$(basename "$tcl")" != "mainBd.tcl" ]; then
+            echo "$tcl"
+        fi
+    done
+}
+
+# Hardware project sources of a project, the cache key is derived from them
+projectSources() {
+    local hwPath
+    hwPath=$(dirname "$1")
+
+    ls "$hwPath"/*.tcl "$hwPath"/*.xdc "$hwPath"/*.ucf 2>/dev/null
+}
+
+# Cache key of a project, a change in any of the sources or the tool version changes it
+cacheKey() {
+    local source
+
+    {
+        echo "$vivadoVersion"
+
+        for source in $(projectSources "$1"); do
+            echo "$(basename "$source") $(sha256sum < "$source" | cut -d' ' -f1)"
+        done
+    } | sha256sum | cut -d' ' -f1
+}
+
+# Copies the cached artifacts into the working directory of the project
+cacheLoad() {
+    local key=$1
+    local name=$2
+    local workDir=$batchOutput/$name
+
+    if [ $batchForce -ne 0 ] || [ ! -f "$batchCache/$key/sources" ]; then
+        return 1
+    fi
+
+    rm -rf "$workDir"
+    mkdir -p "$workDir"
+    cp "$batchCache/$key"/*.hdf "$batchCache/$key"/*.bit "$workDir"/ 2>/dev/null
+}
+
+# Stores the exported artifacts of a regenerated project
+# The entry is completed in a temporary directory, thus a partial entry is never used
+cacheStore() {
+    local key=$1
+    local tcl=$2
+    local name=$3
+    local workDir=$batchOutput/$name
+    local entry=$batchCache/$key.$$.$name
+
+    if ! ls "$workDir"/*.hdf "$workDir"/*.bit > /dev/null 2>&1; then
+        echo "WARNING: $name exported no artifacts, it isn't cached"
+        return 1
+    fi
+
+    mkdir -p "$entry"
+    cp "$workDir"/*.hdf "$workDir"/*.bit "$entry"/
+    {
+        echo "$vivadoVersion"
+        projectSources "$tcl"
+    } > "$entry/sources"
+
+    rm -rf "${batchCache:?}/$key"
+    mv "$entry" "$batchCache/$key"
+}
+
+# Prepares the isolated working directory of a project and runs Vivado in it
+# The project tickle files create the project next to themselves, thus the hardware
+# project directory is copied and the copy is sourced
+runProject() {
+    local tcl=$1
+    local name=$2
+    local workDir=$batchOutput/$name
+
+    rm -rf "$workDir"
+    mkdir -p "$workDir"
+    cp "$(dirname "$tcl")"/*.tcl "$workDir"/
+    cp "$(dirname "$tcl")"/*.xdc "$(dirname "$tcl")"/*.ucf "$workDir"/ 2>/dev/null
+
+    # The GUI can't be started in batch mode
+    # The artifacts are exported into the working directory under the name of the top module
+    cat > "$workDir/batch.tcl" <<TCL
+# Generated by ProjectCreator.sh, runs $(basename "$tcl") headless
+proc start_gui {args} { puts "INFO: start_gui skipped in batch mode" }
+source [file join [file dirname [file normalize [info script]]] $(basename "$tcl")]
+
+launch_runs impl_1 -to_step write_bitstream -jobs $implJobs
+wait_on_run impl_1
+if {[get_property PROGRESS [get_runs impl_1]] != "100%"} {
+    error "ERROR: Implementation of \$project_name failed"
+}
+
+set top [get_property top [current_fileset]]
+file copy -force [get_property DIRECTORY [get_runs impl_1]]/\${top}.bit \${top}.bit
+open_run impl_1
+write_hwdef -force -file \${top}.hdf
+TCL
+
+    cd "$workDir" || return 1
+
+    "$vivadoBin" -mode batch        \
+                 -nojournal         \
+                 -notrace           \
+                 -log vivado.log    \
+                 -source batch.tcl > console.log 2>&1
+}
+
+runBatch() {
+    local option
+    local OPTIND=1
+
+    while getopts "bj:o:c:f" option; do
+        case $option in
+            b) ;;
+            j) batchJobs=$OPTARG ;;
+            o) batchOutput=$(mkdir -p "$OPTARG" && cd "$OPTARG" && pwd) ;;
+            c) batchCache=$(mkdir -p "$OPTARG" && cd "$OPTARG" && pwd) ;;
+            f) batchForce=1 ;;
+            *) echo "ERROR: Usage: $0 -b [-j jobs] [-o outputDir] [-c cacheDir] [-f] [vivadoPath]"; exit 1 ;;
+        esac
+    done
+    shift $((OPTIND - 1))
+
+    if [ $# -gt 0 ]; then
+        vivadoPath=$1
+    fi
+
+    if ! [[ "$batchJobs" =~ ^[1-9][0-9]*$ ]]; then
+        echo "ERROR: Invalid job count $batchJobs!"
+        exit 1
+    fi
+
+    # Vivado executable, either given directly or found through the settings script
+    if [ -n "$VIVADO_BIN" ]; then
+        vivadoBin=$(command -v "$VIVADO_BIN")
+        if [ -n "$vivadoBin" ] && [[ "$vivadoBin" != /* ]]; then
+            vivadoBin=$(cd "$(dirname "$vivadoBin")" && pwd)/$(basename "$vivadoBin")    # Jobs run in their own directories
+        fi
+    elif [ -e "${vivadoPath}/settings64.sh" ]; then
+        source "${vivadoPath}/settings64.sh"
+        vivadoBin=$(command -v vivado)
+    fi
+
+    if [ -z "$vivadoBin" ]; then
+        echo "ERROR: Couldn't find Vivado, give a valid Vivado path or set VIVADO_BIN!"
+        exit 1
+    fi
+
+    local projects=($(findProjects))
+    if [ ${#projects[@]} -eq 0 ]; then
+        echo "ERROR: No project tickle files found under $repoPath!"
+        exit 1
+    fi
+
+    # The version is a part of the cache key, artifacts of another version aren't reused
+    vivadoVersion=$("$vivadoBin" -version 2>/dev/null | head -n 1)
+    if [ -z "$vivadoVersion" ]; then
+        echo "ERROR: Couldn't read the version of $vivadoBin!"
+        exit 1
+    fi
+
+    batchCache=${batchCache:-$batchOutput/.cache}
+    mkdir -p "$batchOutput" "$batchCache"
+    echo "Regenerating ${#projects[@]} projects with $batchJobs parallel jobs using $vivadoVersion"
+    echo "Working directories and logs are under $batchOutput, the cache is $batchCache"
+
+    # Associative arrays need bash 4, the jobs are reaped without the newer "wait" options
+    if [ "${BASH_VERSINFO[0]}" -lt 4 ]; then
+        echo "ERROR: The batch mode needs bash 4 or newer, this is $BASH_VERSION!"
+        exit 1
+    fi
+
+    local -A names starts keys tcls
+    local hits=0
+    local misses=0
+    local -a results
+    local batchStart=$SECONDS
+    local index=0
+    local running=0
+    local pid
+
+    while [ $index -lt ${#projects[@]} ] || [ $running -gt 0 ]; do
+        # Start new jobs as long as there is a free slot
+        if [ $index -lt ${#projects[@]} ] && [ $running -lt $batchJobs ]; then
+            local tcl=${projects[$index]}
+            local name key
+            name=$(basename "$(dirname "$(dirname "$tcl")")")
+            key=$(cacheKey "$tcl")
+
+            # Unchanged projects don't occupy a slot
+            if cacheLoad "$key" "$name"; then
+                results+=("$name|cached|0")
+                hits=$((hits + 1))
+                index=$((index + 1))
+
+                echo "  cached    $name (${key:0:12})"
+                continue
+            fi
+
+            (runProject "$tcl" "$name") &
+            pid=$!
+
+            misses=$((misses + 1))
+            names[$pid]=$name
+            starts[$pid]=$SECONDS
+            keys[$pid]=$key
+            tcls[$pid]=$tcl
+            running=$((running + 1))
+            index=$((index + 1))
+
+            echo "  started   $name"
+            continue
+        fi
+
+        # Wait for any of the jobs to complete, polled since "wait -n -p" needs bash 5.1
+        local status=0
+        local finished=""
+        while [ -z "$finished" ]; do
+            for pid in "${!names[@]}"; do
+                if ! kill -0 "$pid" 2>/dev/null; then
+                    finished=$pid
+                    break
+                fi
+            done
+
+            [ -n "$finished" ] || sleep 1
+        done
+
+        pid=$finished
+        wait "$pid" || status=$?
+        running=$((running - 1))
+
+        local elapsed=$((SECONDS - starts[$pid]))
+        local result="done"
+        if [ $status -ne 0 ]; then
+            result="FAILED($status)"
+        else
+            cacheStore "${keys[$pid]}" "${tcls[$pid]}" "${names[$pid]}"
+        fi
+
+        results+=("${names[$pid]}|$result|$elapsed")
+        echo "  $(printf '%-9s' "$result") ${names[$pid]} (${elapsed}s)"
+
+        # Only the running jobs are polled
+        unset "names[$pid]"
+    done
+
+    # Timing summary
+    local total=$((SECONDS - batchStart))
+    local serial=0
+    local failures=0
+    local entry
+
+    echo
+    printf "%-24s %-12s %8s  %s\n" "Project" "Result" "Time(s)" "Log"
+    for entry in "${results[@]}"; do
+        IFS='|' read -r name result elapsed <<< "$entry"
+        if [ "$result" == "cached" ]; then
+            printf "%-24s %-12s %8s  %s\n" "$name" "$result" "-" "-"
+        else
+            printf "%-24s %-12s %8s  %s\n" "$name" "$result" "$elapsed" "$batchOutput/$name/vivado.log"
+        fi
+
+        serial=$((serial + elapsed))
+        if [[ "$result" == FAILED* ]]; then
+            failures=$((failures + 1))
+        fi
+    done
+
+    echo
+    echo "${#results[@]} projects in ${total}s (${serial}s if run one by one), $failures failed"
+    echo "Cache: $hits hits, $misses misses"
+
+    # Errors of the failed projects, so that the logs don't have to be opened one by one
+    for entry in "${results[@]}"; do
+        IFS='|' read -r name result elapsed <<< "$entry"
+        if [[ "$result" == FAILED* ]]; then
+            echo
+            echo "==> $name"
+            if ! grep -h "^ERROR" "$batchOutput/$name/vivado.log" 2>/dev/null | head -n 10 | grep .; then
+                tail -n 10 "$batchOutput/$name/console.log" 2>/dev/null
+            fi
+        fi
+    done
+
+    if [ $failures -ne 0 ]; then
+        exit 1
+    fi
+
+    exit 0
+}
+
+# Batch mode, all projects are regenerated without the GUI
+if [ "$1" == "-b" ]; then
+    runBatch "$@"
+fi
+
 # Check for command line input arguments
 # First input argument represents the tickle file name(can be full path)
 if [ $# -gt 0 ]; then
@@ -0,0 +1,21 @@
+/**
+ * @file 	SharedBramExchange.c
+ * @brief	Switch value exchange between the Microblaze and the Cortex-A9 through the shared BRAM.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ */
+
+/*** Libraries ***/
+#include "SharedBramExchange.h"
+
+void SharedBramPublishSwitches(XGpio* switches, volatile uint8_t* shared)
+{
+	// Read and store the current value of the switches
+	*shared = XGpio_DiscreteRead(switches, 1);
+}
+
+void SharedBramShowSwitches(XGpio* leds, const volatile uint8_t* shared)
+{
+	// Read the switch status, and use it to set the LEDs
+	XGpio_DiscreteWrite(leds, 1, *shared);
+}
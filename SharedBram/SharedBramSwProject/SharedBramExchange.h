@@ -0,0 +1,27 @@
+/**
+ * @file 	SharedBramExchange.h
+ * @brief	Switch value exchange between the Microblaze and the Cortex-A9 through the shared BRAM.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Both applications add this file next to their main. The Microblaze publishes the
+ * 			switches, the Cortex-A9 shows them on the LEDs. A single byte is exchanged, its
+ * 			writes and reads are atomic, thus no lock is needed.
+ */
+
+#pragma once
+
+/*** Libraries ***/
+#include "xgpio.h"		// BSP of the Xilinx AXI GPIO Controller
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*** Function Declarations ***/
+void SharedBramPublishSwitches(XGpio* switches, volatile uint8_t* shared);	// Microblaze side
+void SharedBramShowSwitches(XGpio* leds, const volatile uint8_t* shared);	// Cortex-A9 side
+
+#ifdef __cplusplus
+}
+#endif
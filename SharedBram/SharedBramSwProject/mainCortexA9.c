@@ -3,12 +3,14 @@
  * @brief	Main source file for the first Cortex-A9 of Shared BRAM Example platform.
  * @author	Caglayan DOKME, caglayandokme@gmail.com
  * @date	August 22, 2021 -> Created
+ * 			October 19, 2026 -> Exchange moved into SharedBramExchange.c.
  */
 
 /*** Libraries ***/
 #include "xparameters.h"	// System related parameters (produced by Vitis based on the provided XSA or HDF)
 #include "xgpio.h"		// BSP of the Xilinx AXI GPIO Controller
 #include "sleep.h"		// Time based operations
+#include "SharedBramExchange.h"
 
 /*** Hardware Instances ***/
 XGpio leds;
@@ -21,13 +23,13 @@ int main()
 		while(1);
 
 	// Current switch value will be stored here
-	uint8_t* switchValue = (uint8_t*)XPAR_BRAM_0_BASEADDR;
+	volatile uint8_t* switchValue = (volatile uint8_t*)XPAR_BRAM_0_BASEADDR;
 
 	/** Application Loop **/
 	while(1)
 	{
 		// Read the switch status, and use it to set the LEDs
-		XGpio_DiscreteWrite(&leds, 1, *switchValue);
+		SharedBramShowSwitches(&leds, switchValue);
 
 		// 1ms delay
 		usleep(1000);
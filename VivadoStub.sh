@@ -0,0 +1,59 @@
+#!/bin/bash
+# Brief     : Stand-in for the Vivado executable, for trying the batch mode of ProjectCreator.sh
+#           : on a PC without Vivado
+# Author    : Caglayan DOKME, caglayandokme@gmail.com
+# Date      : October 19, 2026
+# Note      : Nothing is synthesized. The sourced tickle file is checked, a log is written and an
+#           : empty <project>.xpr is created in the working directory. If the sourced file exports
+#           : the hardware definition, placeholder mainBd_wrapper.bit/.hdf files are created too.
+#           : VIVADO_STUB_DELAY : Seconds a run takes (Default 2)
+#           : VIVADO_STUB_FAIL  : Runs whose tickle file name matches this regex fail
+# Usage     :   VIVADO_BIN=./VivadoStub.sh ./ProjectCreator.sh -b -j 4
+#           :   VIVADO_BIN=./VivadoStub.sh VIVADO_STUB_FAIL=ZynqPsDma ./ProjectCreator.sh -b
+
+source=""
+log=vivado.log
+
+while [ $# -gt 0 ]; do
+    case $1 in
+        -version)   echo "Vivado v2017.4 (stub)"; exit 0 ;;
+        -source)    source=$2; shift ;;
+        -log)       log=$2; shift ;;
+        -mode)      shift ;;
+    esac
+    shift
+done
+
+echo "****** Vivado v2017.4 (stub)" > "$log"
+
+if [ ! -f "$source" ]; then
+    echo "ERROR: [Common 17-69] Could not open '$source'" | tee -a "$log"
+    exit 1
+fi
+
+echo "source $source" >> "$log"
+
+# The wrapper of the batch mode sources the project tickle file
+project=$(sed -n 's/.*\(\<[A-Za-z0-9_]*\.tcl\)\]$/\1/p' "$source" | tail -n 1)
+project=${project:-$(basename "$source")}
+
+sleep "${VIVADO_STUB_DELAY:-2}"
+
+if [ -n "$VIVADO_STUB_FAIL" ] && [[ "$project" =~ $VIVADO_STUB_FAIL ]]; then
+    echo "ERROR: [Stub 1-1] Injected failure while sourcing $project" | tee -a "$log"
+    exit 1
+fi
+
+name=$(sed -n 's/^set project_name[[:space:]]*"\{0,1\}\([^"]*\)"\{0,1\}$/\1/p' "$project" 2>/dev/null | head -n 1)
+touch "${name:-${project%.tcl}}.xpr"
+
+echo "INFO: [Stub 1-2] $project sourced, ${name:-${project%.tcl}}.xpr created" >> "$log"
+
+if grep -q "write_hwdef" "$source"; then
+    echo "Stub bitstream of $project" > mainBd_wrapper.bit
+    echo "Stub hardware definition of $project" > mainBd_wrapper.hdf
+
+    echo "INFO: [Stub 1-3] mainBd_wrapper.bit and mainBd_wrapper.hdf exported" >> "$log"
+fi
+
+exit 0
@@ -0,0 +1,170 @@
+/**
+ * @file 	XadcAcquisitionSim.cpp
+ * @brief	Host test of the buffered XADC acquisition against the register model.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The acquisition is built as is, the XADC is the register model next to this file.
+ * 			Each pacing tick stands for a sequence of conversions: the status registers are
+ * 			written with a code unique to the channel and the tick, then the timer handler
+ * 			runs. The application loop drains the rings in blocks as the example does. Build
+ * 			from the ZedboardXadc folder:
+ * 			g++ -I../Common/HostSim -I../Common -ISwProject SwProject/XadcAcquisition.cpp SwProject/HostSim/XadcAcquisitionSim.cpp -o xadcacqsim
+ */
+
+/** Libraries **/
+#include "xadcps.h"
+#include "xscutimer.h"
+#include "XadcAcquisition.h"
+#include "SimCheck.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define DRAIN_BLOCK_SIZE 	64		// As the conversion block of the example
+#define DRAIN_PERIOD 		100		// Ticks between two passes of the application loop
+#define OVERRUN_TICKS 		10		// Ticks beyond the capacity of the rings
+
+/** Hardware Instances **/
+static XAdcPs 		adc;
+static XScuTimer 	timer;
+
+/** Global Variables **/
+static uint32_t ticks 		= 0;
+
+// 12-bit code of a channel at a tick, the index in the upper bits and the tick in the lower
+static uint16_t CodeOf(const uint8_t idx, const uint32_t tick)
+{
+	return uint16_t((uint32_t(idx) << 9) | (tick & 0x1FF));
+}
+
+// Sequencer converts all channels, then the pacing timer fires
+static void Tick()
+{
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		XAdcPsSimSetCode(&adc, xadcChannels[idx], CodeOf(idx, ticks));
+
+	timer.interruptStatus = 1;
+	XadcAcqIrqHandler(&timer);
+
+	++ticks;
+}
+
+/**
+ * @brief	Drains all channels in blocks and checks the samples against the ticks
+ * @param	firstTick	Tick of the oldest sample expected in the rings
+ * @param	b_inOrder	Cleared if a sample isn't the expected one
+ * @return	Number of samples of each channel, zero if the channels differ
+ */
+static size_t Drain(const uint32_t firstTick, bool& b_inOrder)
+{
+	uint16_t block[DRAIN_BLOCK_SIZE];
+	size_t 	 total[XADC_IDX_COUNT] = {0};
+
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+	{
+		size_t count = 0;
+
+		while(0 != (count = XadcAcqRead(XadcChannelIndex(idx), block, DRAIN_BLOCK_SIZE)))
+		{
+			for(size_t sample = 0; sample < count; ++sample)
+			{
+				const uint16_t expected = uint16_t(CodeOf(idx, firstTick + total[idx] + sample) << 4);
+
+				if(expected != block[sample])
+					b_inOrder = false;
+			}
+
+			total[idx] += count;
+		}
+	}
+
+	for(const size_t count : total)
+	{
+		if(count != total[0])
+			return 0;
+	}
+
+	return total[0];
+}
+
+static void CheckSequence()
+{
+	printf("A sequence over all channels:\n");
+
+	const uint32_t startCommands = adc.commands;
+	Tick();
+
+	bool b_inOrder = true;
+	Check("a sample for each channel", 1 == Drain(ticks - 1, b_inOrder));
+	Check("each ring holds its own channel", b_inOrder);
+	Check("a FIFO round trip per channel plus one", (XADC_IDX_COUNT + 1) == (adc.commands - startCommands));
+	Check("read FIFO drained by the handler", 0 == adc.readCount);
+	Check("no response lost, no empty read", (0 == adc.lostResponses) && (0 == adc.emptyReads));
+	Check("timer interrupt acknowledged", 0 == timer.interruptStatus);
+}
+
+static void CheckContinuous()
+{
+	printf("A second of acquisition, drained every 100ms:\n");
+
+	const uint32_t firstTick = ticks;
+	size_t samples 	= 0;
+	bool b_inOrder 	= true;
+	bool b_steady 	= true;
+
+	for(uint32_t tick = 0; tick < XADC_ACQ_SEQUENCE_RATE_HZ; tick += DRAIN_PERIOD)
+	{
+		for(uint32_t idx = 0; idx < DRAIN_PERIOD; ++idx)
+			Tick();
+
+		const size_t drained = Drain(firstTick + samples, b_inOrder);
+
+		b_steady &= (DRAIN_PERIOD == drained);
+		samples += drained;
+	}
+
+	uint32_t overflows = 0;
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		overflows += XadcAcqOverflows(XadcChannelIndex(idx));
+
+	Check("samples per second of each channel", (XADC_ACQ_SEQUENCE_RATE_HZ == samples) && b_steady);
+	Check("samples in acquisition order", b_inOrder);
+	Check("nothing lost", (0 == overflows) && (0 == adc.lostResponses) && (0 == adc.emptyReads));
+}
+
+static void CheckOverrun()
+{
+	printf("Application loop stalled beyond the ring capacity:\n");
+
+	const uint32_t firstTick = ticks;
+
+	for(uint32_t idx = 0; idx < (XADC_ACQ_RING_SIZE + OVERRUN_TICKS); ++idx)
+		Tick();
+
+	bool b_overflowsCounted = true;
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		b_overflowsCounted &= (OVERRUN_TICKS == XadcAcqOverflows(XadcChannelIndex(idx)));
+
+	// The newest samples are dropped, the buffered ones stay in order
+	bool b_inOrder = true;
+	Check("rings hold their capacity", XADC_ACQ_RING_SIZE == Drain(firstTick, b_inOrder));
+	Check("oldest samples kept in order", b_inOrder);
+	Check("lost samples counted per channel", b_overflowsCounted);
+
+	Tick();
+
+	b_inOrder = true;
+	Check("acquisition resumes once drained", (1 == Drain(ticks - 1, b_inOrder)) && b_inOrder);
+	Check("the FIFOs are never overrun", (0 == adc.lostResponses) && (0 == adc.emptyReads));
+}
+
+int main()
+{
+	XadcAcqInit(&adc);
+
+	CheckSequence();
+	CheckContinuous();
+	CheckOverrun();
+
+	return SimCheckResult();
+}
@@ -0,0 +1,235 @@
+/**
+ * @file 	XadcAlarmSim.cpp
+ * @brief	Host test of the XADC alarm supervision against the register model.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The alarm supervision is built as is, the XADC is the register model next to this
+ * 			file. The sequencer converts all channels each millisecond, the alarm interrupt is
+ * 			taken as soon as it's asserted and the application loop services the alarms after
+ * 			each sequence. Build from the ZedboardXadc folder:
+ * 			g++ -I../Common/HostSim -I../Common -ISwProject SwProject/XadcAcquisition.cpp SwProject/XadcAlarm.cpp SwProject/HostSim/XadcAlarmSim.cpp -o xadcalarmsim
+ */
+
+/** Libraries **/
+#include "xadcps.h"
+#include "xtime_l.h"
+#include "xil_exception.h"
+#include "XadcAlarm.h"
+#include "SimCheck.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define TICKS_PER_MS 		(COUNTS_PER_SECOND / 1000)
+#define HOLDOFF_TICKS 		(XADC_ALARM_HOLDOFF_MS * TICKS_PER_MS)
+#define MAX_EVENTS 			64
+
+/** Custom Structures **/
+struct ChannelLimits{
+	XadcChannelIndex 	index;
+	int32_t 			lower;		// uV or mC
+	int32_t 			upper;
+};
+
+/** Hardware Instances **/
+static XAdcPs adc;
+
+/** Global Variables **/
+// Reset point and limit of the temperature, limits of the supplies
+static const ChannelLimits channelLimits[] = {
+	{XADC_IDX_TEMP, 	75000, 		85000},
+	{XADC_IDX_VCCINT, 	950000, 	1050000},
+	{XADC_IDX_VCCAUX, 	1710000, 	1890000},
+	{XADC_IDX_VBRAM, 	950000, 	1050000},
+	{XADC_IDX_VPVN, 	0, 			900000}		// Has no alarm
+};
+
+// Inputs of the channels, nominal at the start
+static int32_t levels[XADC_IDX_COUNT] = {45000, 1000000, 1800000, 1000000, 1000000, 1800000, 1200000, 500000};
+
+static XadcAlarmEvent 	events[MAX_EVENTS];
+static uint32_t 		eventCount 	= 0;
+
+static XTime Now()
+{
+	return GlobalTimerSimNow();
+}
+
+// 12-bit code of a level, nominal transfer functions of the channels
+static uint16_t CodeOf(const uint8_t idx, const int32_t level)
+{
+	const double code = (XADC_IDX_TEMP == idx) 	? (((level / 1000.0) + 273.15) * 4096 / 503.975)
+						: (XADC_IDX_VPVN == idx) ? (level * 4096.0 / 1000000)
+												 : (level * 4096.0 / 3000000);
+
+	return (code < 0) ? 0 : (code > 4095) ? 4095 : uint16_t(code);
+}
+
+/**
+ * @brief	Runs the sequencer and the application loop for the given time
+ * @return	Number of events the application read
+ */
+static uint32_t Run(const uint32_t milliseconds)
+{
+	const uint32_t startCount = eventCount;
+
+	for(uint32_t ms = 0; ms < milliseconds; ++ms)
+	{
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			XAdcPsSimConvert(&adc, xadcChannels[idx], CodeOf(idx, levels[idx]));
+			ExceptionSimServe();
+		}
+
+		XadcAlarmService();
+
+		XadcAlarmEvent event;
+		while(XadcAlarmRead(event))
+		{
+			events[eventCount++ % MAX_EVENTS] = event;
+		}
+
+		GlobalTimerSimAdvance(TICKS_PER_MS);
+	}
+
+	return eventCount - startCount;
+}
+
+static const XadcAlarmEvent& LastEvent()
+{
+	return events[(eventCount - 1) % MAX_EVENTS];
+}
+
+static void CheckInit()
+{
+	printf("Initialization:\n");
+
+	for(const ChannelLimits& limits : channelLimits)
+		XadcAlarmSetLimits(&adc, limits.index, limits.lower, limits.upper);
+
+	// A stale event from before the initialization
+	adc.intStatus = XADCPS_INTX_ALM1_MASK;
+
+	XadcAlarmInit(&adc);
+
+	Check("thresholds programmed with the limits", (XAdcPs_VoltageToRaw(1.05f) == XAdcPs_GetAlarmThreshold(&adc, XADCPS_ATR_VCCINT_UPPER)) &&
+												   (XAdcPs_VoltageToRaw(1.71f) == XAdcPs_GetAlarmThreshold(&adc, XADCPS_ATR_VCCAUX_LOWER)) &&
+												   (XAdcPs_TemperatureToRaw(85.0f) == XAdcPs_GetAlarmThreshold(&adc, XADCPS_ATR_TEMP_UPPER)) &&
+												   (XAdcPs_TemperatureToRaw(75.0f) == XAdcPs_GetAlarmThreshold(&adc, XADCPS_ATR_TEMP_LOWER)));
+	Check("only the supervised alarms enabled", (XADCPS_CFR1_OT_MASK | XADCPS_CFR1_ALM_TEMP_MASK | XADCPS_CFR1_ALM_VCCINT_MASK |
+												 XADCPS_CFR1_ALM_VCCAUX_MASK | XADCPS_CFR1_ALM_VBRAM_MASK) == XAdcPs_GetAlarmEnables(&adc));
+	Check("VP/VN has no alarm", 0 == XadcAlarmSourceOf(XADC_IDX_VPVN));
+	Check("stale status cleared before enabling", 0 == adc.intStatus);
+	Check("register accesses leave the FIFOs empty", (0 == adc.readCount) && (0 == adc.lostResponses) && (0 == adc.emptyReads));
+
+	Check("no event while nominal", (0 == Run(200)) && (0 == ExceptionSimState().irqCount));
+}
+
+static void CheckOvervoltage()
+{
+	printf("VCCINT at 1.1V for a second:\n");
+
+	levels[XADC_IDX_VCCINT] = 1100000;
+
+	const XTime start = Now();
+	const uint32_t startIrqs = ExceptionSimState().irqCount;
+
+	Check("reported at the conversion", (1 == Run(1)) && (start == LastEvent().timestamp) &&
+										(XADCPS_INTX_ALM1_MASK == LastEvent().sources));
+
+	Run(50);
+	Check("source masked, no interrupt storm", 1 == (ExceptionSimState().irqCount - startIrqs));
+
+	const uint32_t firstEvent 	= eventCount - 1;
+	const uint32_t count 		= 1 + Run(949);
+
+	bool b_spaced = true;
+	for(uint32_t idx = firstEvent + 1; idx < eventCount; ++idx)
+		b_spaced &= ((events[idx].timestamp - events[idx - 1].timestamp) >= HOLDOFF_TICKS);
+
+	Check("reported again once per hold-off", (count >= 9) && (count <= 10) && b_spaced);
+
+	levels[XADC_IDX_VCCINT] = 1000000;
+
+	// The last excursion latched during the hold-off is reported after it, then nothing
+	Run(2 * XADC_ALARM_HOLDOFF_MS);
+	Check("quiet once back within the limits", 0 == Run(500));
+}
+
+static void CheckShortExcursions()
+{
+	printf("Two dips of VCCAUX within a hold-off:\n");
+
+	levels[XADC_IDX_VCCAUX] = 1600000;
+	const XTime start = Now();
+	Check("undervoltage reported", (1 == Run(2)) && (XADCPS_INTX_ALM2_MASK == LastEvent().sources));
+
+	levels[XADC_IDX_VCCAUX] = 1800000;
+	Run(30);
+
+	levels[XADC_IDX_VCCAUX] = 1600000;
+	Check("second dip held back", 0 == Run(2));
+
+	levels[XADC_IDX_VCCAUX] = 1800000;
+	Check("second dip reported once re-armed", (1 == Run(XADC_ALARM_HOLDOFF_MS)) && ((LastEvent().timestamp - start) >= HOLDOFF_TICKS));
+	Check("not reported twice", 0 == Run(500));
+}
+
+static void CheckTemperature()
+{
+	printf("Temperature, alarm at 85C, reset at 75C:\n");
+
+	levels[XADC_IDX_TEMP] = 90000;
+	Check("over the upper threshold", (1 == Run(1)) && (XADCPS_INTX_ALM0_MASK == LastEvent().sources));
+
+	levels[XADC_IDX_TEMP] = 80000;
+	Check("still active above the reset point", Run(3 * XADC_ALARM_HOLDOFF_MS) >= 2);
+
+	levels[XADC_IDX_TEMP] = 70000;
+	Run(2 * XADC_ALARM_HOLDOFF_MS);
+	Check("reset below the lower threshold", 0 == Run(500));
+
+	levels[XADC_IDX_TEMP] = 130000;
+	Check("over-temperature in the same event", (1 == Run(1)) && ((XADCPS_INTX_ALM0_MASK | XADCPS_INTX_OT_MASK) == LastEvent().sources));
+
+	levels[XADC_IDX_TEMP] = 45000;
+	Run(2 * XADC_ALARM_HOLDOFF_MS);
+}
+
+static void CheckSimultaneous()
+{
+	printf("VCCINT and VBRAM out in the same sequence:\n");
+
+	levels[XADC_IDX_VCCINT] = 900000;
+	levels[XADC_IDX_VBRAM] 	= 900000;
+
+	// The interrupt is taken right after each conversion, thus an event for each source
+	const uint32_t count = Run(1);
+	Check("each source reported", (2 == count) && ((XADCPS_INTX_ALM1_MASK | XADCPS_INTX_ALM3_MASK) ==
+								  (events[(eventCount - 2) % MAX_EVENTS].sources | LastEvent().sources)));
+
+	levels[XADC_IDX_VCCINT] = 1000000;
+	levels[XADC_IDX_VBRAM] 	= 1000000;
+	Run(2 * XADC_ALARM_HOLDOFF_MS);
+
+	bool b_ordered = true;
+	for(uint32_t idx = 1; (idx < eventCount) && (idx < MAX_EVENTS); ++idx)
+		b_ordered &= (events[idx].timestamp >= events[idx - 1].timestamp);
+
+	Check("events read in time order", b_ordered && (eventCount <= MAX_EVENTS));
+}
+
+int main()
+{
+	ExceptionSimState().irqLine 	= []() { return XAdcPsSimIrqLine(&adc); };
+	ExceptionSimState().irqHandler 	= []() { XadcAlarmIrqHandler(&adc); };
+	GlobalTimerSimNow() 			= 1000;
+
+	CheckInit();
+	CheckOvervoltage();
+	CheckShortExcursions();
+	CheckTemperature();
+	CheckSimultaneous();
+
+	return SimCheckResult();
+}
@@ -0,0 +1,204 @@
+/**
+ * @file 	XadcDspSim.cpp
+ * @brief	Host test of the XADC stream processing with synthetic signals.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The DSP stage is built as is and fed with converted samples, as the application
+ * 			loop does after the conversion. The decimator and the threshold state of a channel
+ * 			can't be reset, thus each check uses a channel of its own. Build from the
+ * 			ZedboardXadc folder:
+ * 			g++ -I../Common/HostSim -I../Common -ISwProject SwProject/XadcDsp.cpp SwProject/HostSim/XadcDspSim.cpp -o xadcdspsim
+ */
+
+/** Libraries **/
+#include "XadcDsp.h"
+#include "SimCheck.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Definitions **/
+#define WINDOW_SIZE 		1024							// Input samples of a summary window
+#define DECIMATED_SIZE 		(WINDOW_SIZE / XADC_DSP_DECIMATION)
+#define SINE_PERIOD 		1024							// Input samples, far within the pass band
+#define SINE_WINDOWS 		64
+#define WRAP_SAMPLES 		200000							// Enough to wrap the last integrator at full scale
+#define ODD_BLOCK_SIZE 		7								// Not a multiple of the decimation ratio
+
+/** Global Variables **/
+static int32_t 	samples[WINDOW_SIZE];
+
+static bool IsFlat(const XadcSummary& summary, const int32_t value)
+{
+	return (value == summary.min) && (value == summary.max) && (value == summary.mean) && (abs(value) == summary.rms);
+}
+
+static void Fill(const int32_t value)
+{
+	for(int32_t& sample : samples)
+		sample = value;
+}
+
+static void CheckConstant()
+{
+	printf("Constant inputs:\n");
+
+	Fill(1000000);
+	XadcDspProcess(XADC_IDX_VCCINT, samples, WINDOW_SIZE);
+
+	const XadcSummary first = XadcDspTakeSummary(XADC_IDX_VCCINT);
+	Check("settling outputs dropped", (DECIMATED_SIZE - XADC_DSP_CIC_ORDER) == first.count);
+	Check("CIC gain removed exactly", IsFlat(first, 1000000));
+
+	XadcDspProcess(XADC_IDX_VCCINT, samples, WINDOW_SIZE);
+	Check("a decimated sample per ratio afterwards", DECIMATED_SIZE == XadcDspTakeSummary(XADC_IDX_VCCINT).count);
+
+	Fill(-40000);
+	XadcDspProcess(XADC_IDX_TEMP, samples, WINDOW_SIZE);
+	XadcDspProcess(XADC_IDX_TEMP, samples, WINDOW_SIZE);
+	(void) XadcDspTakeSummary(XADC_IDX_TEMP);
+
+	XadcDspProcess(XADC_IDX_TEMP, samples, WINDOW_SIZE);
+	Check("negative temperature kept", IsFlat(XadcDspTakeSummary(XADC_IDX_TEMP), -40000));
+
+	// The last integrator wraps around several times
+	Fill(3000000);
+	for(uint32_t idx = 0; idx < (WRAP_SAMPLES / WINDOW_SIZE); ++idx)
+		XadcDspProcess(XADC_IDX_VCCPDRO, samples, WINDOW_SIZE);
+
+	Check("full scale survives the integrator wrap-around", IsFlat(XadcDspTakeSummary(XADC_IDX_VCCPDRO), 3000000));
+}
+
+static void CheckSine()
+{
+	printf("Sine wave, 1V offset, 100mV amplitude:\n");
+
+	const double offset 	= 1000000;
+	const double amplitude 	= 100000;
+
+	for(uint32_t window = 0; window < SINE_WINDOWS; ++window)
+	{
+		for(size_t idx = 0; idx < WINDOW_SIZE; ++idx)
+			samples[idx] = int32_t(lround(offset + (amplitude * sin((2 * M_PI * idx) / SINE_PERIOD))));
+
+		XadcDspProcess(XADC_IDX_VCCAUX, samples, WINDOW_SIZE);
+	}
+
+	const XadcSummary summary = XadcDspTakeSummary(XADC_IDX_VCCAUX);
+	const double rms = sqrt((offset * offset) + (amplitude * amplitude / 2));
+
+	printf("  min %d, max %d, mean %d, rms %d\n", int(summary.min), int(summary.max), int(summary.mean), int(summary.rms));
+
+	Check("peaks within 0.1% of the amplitude", (fabs(summary.min - (offset - amplitude)) < (amplitude / 1000)) &&
+												(fabs(summary.max - (offset + amplitude)) < (amplitude / 1000)));
+	Check("mean at the offset", fabs(summary.mean - offset) < (amplitude / 1000));
+	Check("RMS of the offset and the sine", fabs(summary.rms - rms) < (amplitude / 1000));
+	Check("no excursion without limits", (0 == summary.excursions) && !summary.b_outOfRange);
+}
+
+static void CheckAliasing()
+{
+	printf("Tone at half the input rate:\n");
+
+	// A null of the CIC response, nothing of it may alias into the decimated stream
+	for(size_t idx = 0; idx < WINDOW_SIZE; ++idx)
+		samples[idx] = 1000000 + ((0 == (idx % 2)) ? 200000 : -200000);
+
+	XadcDspProcess(XADC_IDX_VBRAM, samples, WINDOW_SIZE);
+	XadcDspProcess(XADC_IDX_VBRAM, samples, WINDOW_SIZE);
+
+	Check("tone removed by the decimator", IsFlat(XadcDspTakeSummary(XADC_IDX_VBRAM), 1000000));
+}
+
+static void CheckThresholds()
+{
+	printf("Pulses against the limits of 0.95V and 1.05V:\n");
+
+	XadcDspSetLimits(XADC_IDX_VCCPINT, 950000, 1050000);
+
+	Fill(1000000);
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	// Two spikes and a dip of 200 samples
+	for(size_t start = 100; start < 700; start += 300)
+	{
+		for(size_t idx = start; idx < (start + 200); ++idx)
+			samples[idx] = 1100000;
+	}
+
+	for(size_t idx = 700; idx < 900; ++idx)
+		samples[idx] = 900000;
+
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	Fill(1000000);
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	XadcSummary summary = XadcDspTakeSummary(XADC_IDX_VCCPINT);
+	Check("each excursion counted once", 3 == summary.excursions);
+	Check("back within the limits", !summary.b_outOfRange);
+
+	// A glitch of a single sample
+	samples[WINDOW_SIZE / 2] = 1100000;
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	summary = XadcDspTakeSummary(XADC_IDX_VCCPINT);
+	Check("single sample glitch filtered out", (0 == summary.excursions) && (summary.max < 1050000));
+
+	// Still out of range when the window ends
+	Fill(1100000);
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	summary = XadcDspTakeSummary(XADC_IDX_VCCPINT);
+	Check("excursion open at the end of a window", (1 == summary.excursions) && summary.b_outOfRange);
+
+	XadcDspProcess(XADC_IDX_VCCPINT, samples, WINDOW_SIZE);
+
+	summary = XadcDspTakeSummary(XADC_IDX_VCCPINT);
+	Check("not counted again in the next window", (0 == summary.excursions) && summary.b_outOfRange);
+}
+
+static void CheckBlockSizes()
+{
+	printf("Same stream in windows and in odd blocks:\n");
+
+	uint32_t seed = 1;
+
+	for(uint32_t window = 0; window < 8; ++window)
+	{
+		// Ramp with pseudo-random noise
+		for(size_t idx = 0; idx < WINDOW_SIZE; ++idx)
+		{
+			seed = (seed * 1103515245) + 12345;
+			samples[idx] = int32_t(500000 + (idx * 100) + ((seed >> 16) % 20000));
+		}
+
+		XadcDspProcess(XADC_IDX_VCCPAUX, samples, WINDOW_SIZE);
+
+		for(size_t idx = 0; idx < WINDOW_SIZE; idx += ODD_BLOCK_SIZE)
+		{
+			const size_t count = ((WINDOW_SIZE - idx) < ODD_BLOCK_SIZE) ? (WINDOW_SIZE - idx) : ODD_BLOCK_SIZE;
+
+			XadcDspProcess(XADC_IDX_VPVN, &samples[idx], count);
+		}
+	}
+
+	const XadcSummary whole = XadcDspTakeSummary(XADC_IDX_VCCPAUX);
+	const XadcSummary split = XadcDspTakeSummary(XADC_IDX_VPVN);
+
+	Check("identical summaries", (whole.count == split.count) && (whole.min == split.min) && (whole.max == split.max) &&
+								 (whole.mean == split.mean) && (whole.rms == split.rms));
+	Check("channels kept apart", (0 == XadcDspTakeSummary(XADC_IDX_VCCINT).count) && (0 != whole.count));
+}
+
+int main()
+{
+	CheckConstant();
+	CheckSine();
+	CheckAliasing();
+	CheckThresholds();
+	CheckBlockSizes();
+
+	return SimCheckResult();
+}
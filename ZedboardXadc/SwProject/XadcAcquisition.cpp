@@ -0,0 +1,85 @@
+/**
+ * @brief	  	Buffered, continuous acquisition of the XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "XadcAcquisition.h"
+#include "xscutimer.h"
+
+/** Global Variables **/
+const uint8_t xadcChannels[XADC_IDX_COUNT] = {
+	XADCPS_CH_TEMP,
+	XADCPS_CH_VCCINT,
+	XADCPS_CH_VCCAUX,
+	XADCPS_CH_VBRAM,
+	XADCPS_CH_VCCPINT,
+	XADCPS_CH_VCCPAUX,
+	XADCPS_CH_VCCPDRO,
+	XADCPS_CH_VPVN
+};
+
+static XAdcPs* 			p_adc = nullptr;
+static XadcSampleRing 	sampleRings[XADC_IDX_COUNT];
+
+void XadcAcqInit(XAdcPs* adc)
+{
+	if(nullptr == adc)
+		while(1);
+
+	p_adc = adc;
+}
+
+/**
+ * @brief	Reads the latest conversion results of all channels in a single pass
+ * @param	raw	Destination of the raw 16-bit register values
+ *
+ * @note	Each command written to the command FIFO produces a word in the read FIFO,
+ * 			holding the result of the previous command. The BSP issues a dummy command
+ * 			after each read, costing two FIFO round trips per channel. Here the read
+ * 			commands of all channels are queued back-to-back followed by a single dummy
+ * 			command, so the whole sequence costs one round trip per channel plus one.
+ * 			The FIFOs are 15 words deep which is enough for all eight channels.
+ */
+static void ReadSequence(uint16_t (&raw)[XADC_IDX_COUNT])
+{
+	for(const uint8_t channel : xadcChannels)
+		XAdcPs_WriteFifo(p_adc, XAdcPs_FormatWriteData((XADCPS_TEMP_OFFSET + channel), 0x0, false));
+
+	// Dummy command to push out the result of the last read
+	XAdcPs_WriteFifo(p_adc, 0x0);
+
+	// First word is the response of the command preceding this sequence
+	(void) XAdcPs_ReadFifo(p_adc);
+
+	for(uint16_t& value : raw)
+		value = uint16_t(XAdcPs_ReadFifo(p_adc) & XADCPS_JTAG_DATA_MASK);
+}
+
+void XadcAcqIrqHandler(XScuTimer* timer)
+{
+	XScuTimer_ClearInterruptStatus(timer);
+
+	uint16_t raw[XADC_IDX_COUNT];
+	ReadSequence(raw);
+
+	for(size_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		sampleRings[idx].Push(raw[idx]);
+}
+
+size_t XadcAcqRead(XadcChannelIndex index, uint16_t* raw, size_t count)
+{
+	if(index >= XADC_IDX_COUNT)
+		return 0;
+
+	return sampleRings[index].Read(raw, count);
+}
+
+uint32_t XadcAcqOverflows(XadcChannelIndex index)
+{
+	if(index >= XADC_IDX_COUNT)
+		return 0;
+
+	return sampleRings[index].Overflows();
+}
@@ -0,0 +1,46 @@
+/**
+ * @brief	  	Buffered, continuous acquisition of the XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		The PS-XADC interface doesn't provide an end-of-sequence interrupt, only the
+ * 				alarm and FIFO threshold interrupts. Thus, the acquisition is paced by the
+ * 				private timer. At each tick, the read commands of all channels are pushed
+ * 				into the command FIFO at once and the results are collected in a single pass.
+ * 				Raw samples are stored per channel, conversion is left to the consumer.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xadcps.h"
+#include "xscutimer.h"
+#include "RingBuffer.h"
+
+/** Definitions **/
+#define XADC_ACQ_SEQUENCE_RATE_HZ	1000	// Rate of the pacing timer (sequences per second)
+#define XADC_ACQ_RING_SIZE			1024	// Samples per channel, must be a power of two
+
+/** Custom Structures **/
+enum XadcChannelIndex : uint8_t{
+	XADC_IDX_TEMP = 0,
+	XADC_IDX_VCCINT,
+	XADC_IDX_VCCAUX,
+	XADC_IDX_VBRAM,
+	XADC_IDX_VCCPINT,
+	XADC_IDX_VCCPAUX,
+	XADC_IDX_VCCPDRO,
+	XADC_IDX_VPVN,
+	XADC_IDX_COUNT
+};
+
+typedef RingBuffer<uint16_t, XADC_ACQ_RING_SIZE> XadcSampleRing;
+
+/** Global Variables **/
+extern const uint8_t xadcChannels[XADC_IDX_COUNT];		// XADC channel number of each index
+
+/** Function Declarations **/
+void 		XadcAcqInit(XAdcPs* adc);										// Must be called after the sequencer is started
+void 		XadcAcqIrqHandler(XScuTimer* timer);								// Must be connected to the pacing timer IRQ
+size_t 		XadcAcqRead(XadcChannelIndex index, uint16_t* raw, size_t count);	// Drains raw samples of a channel
+uint32_t 	XadcAcqOverflows(XadcChannelIndex index);						// Number of samples lost due to a full ring
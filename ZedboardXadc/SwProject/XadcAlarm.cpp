@@ -0,0 +1,170 @@
+/**
+ * @brief	  	Hardware alarm based supervision of the XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "XadcAlarm.h"
+#include "xil_exception.h"
+
+/** Definitions **/
+#define ALARM_EVENT_QUEUE_SIZE	32
+#define ALARM_SOURCE_COUNT		8	// Seven channel alarms and the over-temperature
+
+#define HOLDOFF_TICKS			(XTime(COUNTS_PER_SECOND) * XADC_ALARM_HOLDOFF_MS / 1000)
+
+/** Custom Structures **/
+struct AlarmChannel{
+	uint8_t 	upperRegister;		// XADCPS_ATR_xxx_UPPER
+	uint8_t 	lowerRegister;		// XADCPS_ATR_xxx_LOWER
+	uint16_t 	enableMask;			// XADCPS_CFR1_ALM_xxx_MASK
+	uint32_t 	interruptMask;		// XADCPS_INTX_ALMx_MASK
+};
+
+/** Global Variables **/
+// Ordered as XadcChannelIndex, VP/VN has no alarm
+static const AlarmChannel alarmChannels[XADC_IDX_COUNT] = {
+	{XADCPS_ATR_TEMP_UPPER, 	XADCPS_ATR_TEMP_LOWER, 		XADCPS_CFR1_ALM_TEMP_MASK, 		XADCPS_INTX_ALM0_MASK},
+	{XADCPS_ATR_VCCINT_UPPER, 	XADCPS_ATR_VCCINT_LOWER, 	XADCPS_CFR1_ALM_VCCINT_MASK, 	XADCPS_INTX_ALM1_MASK},
+	{XADCPS_ATR_VCCAUX_UPPER, 	XADCPS_ATR_VCCAUX_LOWER, 	XADCPS_CFR1_ALM_VCCAUX_MASK, 	XADCPS_INTX_ALM2_MASK},
+	{XADCPS_ATR_VBRAM_UPPER, 	XADCPS_ATR_VBRAM_LOWER, 	XADCPS_CFR1_ALM_VBRAM_MASK, 	XADCPS_INTX_ALM3_MASK},
+	{XADCPS_ATR_VCCPINT_UPPER, 	XADCPS_ATR_VCCPINT_LOWER, 	XADCPS_CFR1_ALM_VCCPINT_MASK, 	XADCPS_INTX_ALM4_MASK},
+	{XADCPS_ATR_VCCPAUX_UPPER, 	XADCPS_ATR_VCCPAUX_LOWER, 	XADCPS_CFR1_ALM_VCCPAUX_MASK, 	XADCPS_INTX_ALM5_MASK},
+	{XADCPS_ATR_VCCPDRO_UPPER, 	XADCPS_ATR_VCCPDRO_LOWER, 	XADCPS_CFR1_ALM_VCCPDRO_MASK, 	XADCPS_INTX_ALM6_MASK},
+	{0, 						0, 							0, 								0}
+};
+
+static XAdcPs* 				p_adc 				= nullptr;
+static uint16_t 			enabledAlarms 		= 0;	// XADCPS_CFR1_xxx bits of the supervised sources
+static uint32_t 			supervisedSources 	= 0;	// XADCPS_INTX_xxx bits of the supervised sources
+static volatile uint32_t 	armedSources 		= 0;	// XADCPS_INTX_xxx bits allowed to interrupt
+
+static RingBuffer<XadcAlarmEvent, ALARM_EVENT_QUEUE_SIZE> events;
+
+// Time of the last event of each source, indexed by the bit position
+static volatile XTime lastEventTimes[ALARM_SOURCE_COUNT] = {0};
+
+/**
+ * @brief	Converts a value in output units to a raw register value (nominal transfer function)
+ */
+static uint16_t ToRaw(const XadcChannelIndex index, const int32_t value)
+{
+	int raw = (XADC_IDX_TEMP == index) 	? XAdcPs_TemperatureToRaw(value / 1000.0f)
+										: XAdcPs_VoltageToRaw(value / 1000000.0f);
+
+	if(raw < 0)
+		raw = 0;
+
+	if(raw > 0xFFFF)
+		raw = 0xFFFF;
+
+	return uint16_t(raw);
+}
+
+void XadcAlarmSetLimits(XAdcPs* adc, XadcChannelIndex index, int32_t lower, int32_t upper)
+{
+	if((nullptr == adc) || (index >= XADC_IDX_COUNT) || (lower > upper))
+		while(1);
+
+	const AlarmChannel& channel = alarmChannels[index];
+
+	// Channel has no alarm
+	if(0 == channel.enableMask)
+		return;
+
+	XAdcPs_SetAlarmThreshold(adc, channel.upperRegister, ToRaw(index, upper));
+	XAdcPs_SetAlarmThreshold(adc, channel.lowerRegister, ToRaw(index, lower));
+
+	enabledAlarms 		|= channel.enableMask;
+	supervisedSources 	|= channel.interruptMask;
+}
+
+void XadcAlarmInit(XAdcPs* adc)
+{
+	if(nullptr == adc)
+		while(1);
+
+	p_adc = adc;
+
+	// Over-temperature is always supervised, using the device's default threshold
+	enabledAlarms 		|= XADCPS_CFR1_OT_MASK;
+	supervisedSources 	|= XADCPS_INTX_OT_MASK;
+
+	XAdcPs_SetAlarmEnables(p_adc, enabledAlarms);
+
+	// Clear the stale events before enabling the interrupts
+	XAdcPs_IntrClear(p_adc, XADCPS_INTX_ALL_MASK);
+
+	armedSources = supervisedSources;
+	XAdcPs_IntrEnable(p_adc, armedSources);
+}
+
+void XadcAlarmIrqHandler(XAdcPs* adc)
+{
+	XadcAlarmEvent event;
+	XTime_GetTime(&event.timestamp);
+
+	event.sources = XAdcPs_IntrGetStatus(adc) & armedSources;
+	XAdcPs_IntrClear(adc, event.sources);
+
+	if(0 == event.sources)
+		return;
+
+	// Sources stay masked until their hold-off expires
+	XAdcPs_IntrDisable(adc, event.sources);
+	armedSources &= ~event.sources;
+
+	for(uint8_t bit = 0; bit < ALARM_SOURCE_COUNT; ++bit)
+	{
+		if(0 != (event.sources & (1u << bit)))
+			lastEventTimes[bit] = event.timestamp;
+	}
+
+	events.Push(event);
+}
+
+bool XadcAlarmRead(XadcAlarmEvent& event)
+{
+	return events.Pop(event);
+}
+
+void XadcAlarmService()
+{
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	// Interrupt mask register is modified by the handler as well
+	Xil_ExceptionDisableMask(XIL_EXCEPTION_IRQ);
+
+	uint32_t rearm = 0;
+	for(uint8_t bit = 0; bit < ALARM_SOURCE_COUNT; ++bit)
+	{
+		const uint32_t source = (1u << bit);
+
+		// Only the supervised sources that fired are candidates
+		if((0 != (armedSources & source)) || (0 == (supervisedSources & source)))
+			continue;
+
+		if((now - lastEventTimes[bit]) >= HOLDOFF_TICKS)
+			rearm |= source;
+	}
+
+	// Status bits latched during the hold-off are kept, an alarm still active fires right away
+	if(0 != rearm)
+	{
+		armedSources |= rearm;
+
+		XAdcPs_IntrEnable(p_adc, rearm);
+	}
+
+	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+}
+
+uint32_t XadcAlarmSourceOf(XadcChannelIndex index)
+{
+	if(index >= XADC_IDX_COUNT)
+		return 0;
+
+	return alarmChannels[index].interruptMask;
+}
@@ -0,0 +1,41 @@
+/**
+ * @brief	  	Hardware alarm based supervision of the XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		The XADC compares each conversion against the upper and lower alarm thresholds
+ * 				in hardware. An alarm raises the XADC interrupt, the handler stamps the event
+ * 				with the global timer and queues it. No polling is needed to catch excursions.
+ *
+ * 				An alarm source stays active as long as the channel is out of its limits. To
+ * 				prevent an interrupt storm, a source is masked once it fires and re-armed by
+ * 				XadcAlarmService() after a hold-off period. A source still active at that
+ * 				moment is reported again, at most once per hold-off period.
+ *
+ * 				For the temperature channel the lower threshold is the reset point of the
+ * 				alarm (hysteresis), not an under-temperature limit.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xadcps.h"
+#include "xtime_l.h"
+#include "XadcAcquisition.h"
+
+/** Definitions **/
+#define XADC_ALARM_HOLDOFF_MS	100		// Minimum time between two events of the same source
+
+/** Custom Structures **/
+struct XadcAlarmEvent{
+	XTime 		timestamp	= 0;	// Global timer value at the interrupt
+	uint32_t 	sources		= 0;	// XADCPS_INTX_ALMx_MASK and XADCPS_INTX_OT_MASK bits
+};
+
+/** Function Declarations **/
+void 	XadcAlarmSetLimits(XAdcPs* adc, XadcChannelIndex index, int32_t lower, int32_t upper);	// uV or mC, before XadcAlarmInit()
+void 	XadcAlarmInit(XAdcPs* adc);					// Enables the alarms whose limits are set
+void 	XadcAlarmIrqHandler(XAdcPs* adc);				// Must be connected to the XADC interrupt
+bool 	XadcAlarmRead(XadcAlarmEvent& event);		// Pops the oldest event
+void 	XadcAlarmService();							// Re-arms the sources whose hold-off expired
+uint32_t XadcAlarmSourceOf(XadcChannelIndex index);	// Interrupt bit of a channel, zero if it has no alarm
@@ -0,0 +1,227 @@
+/**
+ * @brief	  	Fixed-point calibration and conversion of raw XADC samples
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Calibration copied into locals before the conversion loops.
+ * 				October 19, 2026 -> Scalar conversion made vectorizable.
+ */
+
+/** Libraries **/
+#include "XadcCalibration.h"
+#include "xtime_l.h"
+#include <stdio.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/** Definitions **/
+#define ADC_CODE_COUNT		4096	// 12-bit conversion results
+#define ADC_CODE_SHIFT		4		// Results are MSB justified in the 16-bit registers
+
+// Nominal transfer functions (UG480)
+#define SUPPLY_FULL_SCALE_UV	3000000.0		// Supply sensors measure up to 3V
+#define VPVN_FULL_SCALE_UV		1000000.0		// Dedicated analog input is 1V unipolar
+#define TEMP_FULL_SCALE_MC		503975.0		// Temperature sensor, milli-Kelvin at full scale
+#define TEMP_OFFSET_MC			(-273150.0)		// Kelvin to Celsius
+
+#define BENCHMARK_BLOCK_SIZE	1024
+
+/** Global Variables **/
+static XadcChannelCalibration calibrations[XADC_IDX_COUNT];
+
+/**
+ * @brief	Builds the fixed-point representation of a linear transfer function
+ * @param	unitsPerCode	Output units per ADC code
+ * @param	offset			Output units at code zero
+ */
+static XadcChannelCalibration MakeCalibration(const double unitsPerCode, const double offset)
+{
+	XadcChannelCalibration calibration;
+
+	// Use the largest shift that keeps the mantissa in Q15 range to maximize the precision
+	uint8_t shift = 0;
+	while((shift < 30) && ((unitsPerCode * double(1u << (shift + 1))) < 32767.0))
+		++shift;
+
+	calibration.gain 	= int16_t((unitsPerCode * double(1u << shift)) + 0.5);
+	calibration.shift 	= shift;
+	calibration.offset 	= int32_t((offset >= 0) ? (offset + 0.5) : (offset - 0.5));
+
+	return calibration;
+}
+
+/**
+ * @brief	Builds the calibrations of all channels
+ * @param	supplyOffset	Offset of the supply sensors in ADC codes
+ * @param	adcOffset		Offset of the ADC in ADC codes (temperature and VP/VN)
+ * @param	gainCorrection	Factor compensating the gain error of the ADC
+ */
+static void BuildCalibrations(const int16_t supplyOffset, const int16_t adcOffset, const double gainCorrection)
+{
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+	{
+		double unitsPerCode = SUPPLY_FULL_SCALE_UV / ADC_CODE_COUNT;
+		double offset 		= 0;
+		int16_t codeOffset 	= supplyOffset;
+
+		if(XADC_IDX_TEMP == idx)
+		{
+			unitsPerCode 	= TEMP_FULL_SCALE_MC / ADC_CODE_COUNT;
+			offset 			= TEMP_OFFSET_MC;
+			codeOffset 		= adcOffset;
+		}
+		else if(XADC_IDX_VPVN == idx)
+		{
+			// BSP's XAdcPs_RawToVoltage assumes 3V full scale for all channels, which is wrong for VP/VN
+			unitsPerCode 	= VPVN_FULL_SCALE_UV / ADC_CODE_COUNT;
+			codeOffset 		= adcOffset;
+		}
+
+		unitsPerCode *= gainCorrection;
+
+		// The code offset is folded into the output offset
+		calibrations[idx] = MakeCalibration(unitsPerCode, offset - (codeOffset * unitsPerCode));
+	}
+}
+
+void XadcCalibLoadDefaults()
+{
+	BuildCalibrations(0, 0, 1.0);
+}
+
+void XadcCalibLoadFromDevice(XAdcPs* adc)
+{
+	if(nullptr == adc)
+		while(1);
+
+	// Offsets are 12-bit two's complement values, MSB justified
+	const int16_t supplyOffset 	= int16_t(XAdcPs_GetCalibCoefficient(adc, XADCPS_CALIB_SUPPLY_OFFSET_COEFF)) >> ADC_CODE_SHIFT;
+	const int16_t adcOffset 	= int16_t(XAdcPs_GetCalibCoefficient(adc, XADCPS_CALIB_ADC_OFFSET_COEFF)) 	>> ADC_CODE_SHIFT;
+
+	// Gain error is given in 0.1% steps, bit 6 is the sign
+	const uint16_t gainCoeff 	= XAdcPs_GetCalibCoefficient(adc, XADCPS_CALIB_GAIN_ERROR_COEFF);
+	const double gainError 		= ((gainCoeff & 0x40) ? -1.0 : 1.0) * double(gainCoeff & 0x3F) * 0.001;
+
+	BuildCalibrations(supplyOffset, adcOffset, 1.0 / (1.0 + gainError));
+}
+
+const XadcChannelCalibration& XadcCalibGet(XadcChannelIndex index)
+{
+	if(index >= XADC_IDX_COUNT)
+		while(1);
+
+	return calibrations[index];
+}
+
+/**
+ * @brief	Converts a fixed number of samples with the scalar arithmetic
+ */
+template<size_t Count>
+static inline void ConvertSamples(const uint16_t* __restrict raw, int32_t* __restrict converted, const int16_t gain,
+								  const uint8_t shift, const int32_t rounding, const int32_t offset)
+{
+	// Codes are staged as signed 16-bit values so that the product becomes a 16x16 bit
+	// widening multiply as VMULL, a 32-bit multiply is much slower on most SIMD units
+	int16_t codes[Count];
+
+	for(size_t idx = 0; idx < Count; ++idx)
+		codes[idx] = int16_t(raw[idx] >> ADC_CODE_SHIFT);
+
+	for(size_t idx = 0; idx < Count; ++idx)
+		converted[idx] = ((int32_t(codes[idx]) * gain + rounding) >> shift) + offset;
+}
+
+void XadcConvertBlock(XadcChannelIndex index, const uint16_t* raw, int32_t* converted, size_t count)
+{
+	const XadcChannelCalibration& calibration = XadcCalibGet(index);
+	size_t idx = 0;
+
+	// The output may alias the calibration (both hold int32_t), a store through it would
+	// force the compiler to reload the fields for each sample unless they are copied first
+	const int16_t gain 		= calibration.gain;
+	const uint8_t shift 	= calibration.shift;
+	const int32_t offset 	= calibration.offset;
+
+#if defined(__ARM_NEON)
+	const int16x4_t gainLanes 	= vdup_n_s16(gain);
+	const int32x4_t shiftLanes 	= vdupq_n_s32(-int32_t(shift));	// Negative shift means right shift
+	const int32x4_t offsetLanes = vdupq_n_s32(offset);
+
+	for(; (idx + 8) <= count; idx += 8)
+	{
+		const int16x8_t codes = vreinterpretq_s16_u16(vshrq_n_u16(vld1q_u16(raw + idx), ADC_CODE_SHIFT));
+
+		// 12-bit code times Q15 mantissa always fits in 32 bits
+		int32x4_t low 	= vmull_s16(vget_low_s16(codes), 	gainLanes);
+		int32x4_t high 	= vmull_s16(vget_high_s16(codes), 	gainLanes);
+
+		low 	= vaddq_s32(vrshlq_s32(low, 	shiftLanes), offsetLanes);
+		high 	= vaddq_s32(vrshlq_s32(high, 	shiftLanes), offsetLanes);
+
+		vst1q_s32(converted + idx, 		low);
+		vst1q_s32(converted + idx + 4, 	high);
+	}
+#endif
+
+	// Same rounding as VRSHL. Without NEON, blocks of eight have a fixed trip count and
+	// distinct buffers, thus the compiler can vectorize them without runtime checks
+	const int32_t rounding = (0 == shift) ? 0 : (int32_t(1) << (shift - 1));
+
+	for(; (idx + 8) <= count; idx += 8)
+		ConvertSamples<8>(raw + idx, converted + idx, gain, shift, rounding, offset);
+
+	for(; idx < count; ++idx)
+		ConvertSamples<1>(raw + idx, converted + idx, gain, shift, rounding, offset);
+}
+
+void XadcCalibBenchmark()
+{
+	static uint16_t raw[BENCHMARK_BLOCK_SIZE];
+	static int32_t 	converted[BENCHMARK_BLOCK_SIZE];
+	static float 	reference[BENCHMARK_BLOCK_SIZE];
+
+	// Ramp covering all codes
+	for(size_t idx = 0; idx < BENCHMARK_BLOCK_SIZE; ++idx)
+		raw[idx] = uint16_t((idx * (ADC_CODE_COUNT / BENCHMARK_BLOCK_SIZE)) << ADC_CODE_SHIFT);
+
+	// Nominal transfer functions so that the results are comparable with the BSP
+	XadcChannelCalibration saved[XADC_IDX_COUNT];
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		saved[idx] = calibrations[idx];
+
+	XadcCalibLoadDefaults();
+
+	XTime start = 0, end = 0;
+
+	XTime_GetTime(&start);
+	for(size_t idx = 0; idx < BENCHMARK_BLOCK_SIZE; ++idx)
+		reference[idx] = XAdcPs_RawToVoltage(raw[idx]);
+	XTime_GetTime(&end);
+
+	const XTime floatTicks = end - start;
+
+	XTime_GetTime(&start);
+	XadcConvertBlock(XADC_IDX_VCCINT, raw, converted, BENCHMARK_BLOCK_SIZE);
+	XTime_GetTime(&end);
+
+	const XTime fixedTicks = end - start;
+
+	// Worst deviation from the float conversion in micro-volts
+	float maxError = 0;
+	for(size_t idx = 0; idx < BENCHMARK_BLOCK_SIZE; ++idx)
+	{
+		float error = (reference[idx] * 1000000.0f) - float(converted[idx]);
+		if(error < 0)
+			error = -error;
+
+		if(error > maxError)
+			maxError = error;
+	}
+
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		calibrations[idx] = saved[idx];
+
+	printf("Conversion of %u samples: float %u ticks, fixed-point %u ticks, max error %f uV\r\n",
+			unsigned(BENCHMARK_BLOCK_SIZE), unsigned(floatTicks), unsigned(fixedTicks), maxError);
+}
@@ -0,0 +1,40 @@
+/**
+ * @brief	  	Fixed-point calibration and conversion of raw XADC samples
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Scalar conversion made vectorizable.
+ *
+ * @note		Each channel has a scale factor stored as a Q15 mantissa with a right shift,
+ * 				and an offset. A raw sample is converted with a single multiply, a rounding
+ * 				shift and an addition. Blocks of samples are converted eight at a time with
+ * 				NEON when the compiler targets it (add -mfpu=neon to the compiler flags),
+ * 				otherwise with a scalar loop of the very same arithmetic that the compiler
+ * 				can vectorize (a 16x16 bit widening multiply and a uniform shift).
+ *
+ * 				The gain in speed depends on the float conversion it replaces. GCC leaves a
+ * 				float loop scalar on NEON unless -ffast-math is given, the SSE of an x86 host
+ * 				vectorizes it as well, where it remains the faster one.
+ *
+ * 				Outputs are integers: micro-volts for the voltage channels and milli-degrees
+ * 				Celsius for the temperature channel.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xadcps.h"
+#include "XadcAcquisition.h"
+
+/** Custom Structures **/
+struct XadcChannelCalibration{
+	int16_t 	gain	= 0;	// Q15 mantissa of the output units per ADC code
+	uint8_t 	shift	= 0;	// Right shift applied to the product (rounding)
+	int32_t 	offset	= 0;	// Added after scaling, in output units
+};
+
+/** Function Declarations **/
+void XadcCalibLoadDefaults();					// Nominal transfer functions of the channels (no device correction)
+void XadcCalibLoadFromDevice(XAdcPs* adc);		// Nominal transfer functions corrected with the device calibration coefficients
+const XadcChannelCalibration& XadcCalibGet(XadcChannelIndex index);
+void XadcConvertBlock(XadcChannelIndex index, const uint16_t* raw, int32_t* converted, size_t count);
+void XadcCalibBenchmark();						// Compares the fixed-point conversion with the BSP float conversion
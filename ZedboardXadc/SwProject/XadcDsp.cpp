@@ -0,0 +1,167 @@
+/**
+ * @brief	  	Streaming decimation, statistics and threshold detection of XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> CIC state made modular.
+ */
+
+/** Libraries **/
+#include "XadcDsp.h"
+#include <math.h>
+
+/** Definitions **/
+static_assert(0 == (XADC_DSP_DECIMATION & (XADC_DSP_DECIMATION - 1)), "Decimation ratio must be a power of two!");
+
+// CIC gain is DECIMATION ^ ORDER, a power of two, thus it is removed with a shift
+static constexpr uint8_t Log2(const uint32_t value) { return (value <= 1) ? 0 : (1 + Log2(value >> 1)); }
+static constexpr uint8_t CIC_GAIN_SHIFT = XADC_DSP_CIC_ORDER * Log2(XADC_DSP_DECIMATION);
+
+/** Custom Structures **/
+// Integrators of a CIC filter grow without bound for a DC input and wrap around. The state is
+// unsigned so that the wrap-around is well defined, the combs cancel it as long as the output
+// (input range times the CIC gain) fits in the word.
+struct CicDecimator{
+	uint64_t 	integrators[XADC_DSP_CIC_ORDER] = {0};
+	uint64_t 	combDelays[XADC_DSP_CIC_ORDER] 	= {0};
+	uint32_t 	phase 	= 0;
+	uint32_t 	warmUp 	= XADC_DSP_CIC_ORDER;	// Outputs to drop while the filter settles
+};
+
+struct ChannelState{
+	CicDecimator 	cic;
+
+	// Threshold detection
+	int32_t 		lowerLimit 	= INT32_MIN;
+	int32_t 		upperLimit 	= INT32_MAX;
+	bool 			b_outOfRange = false;
+	uint32_t 		excursions 	= 0;
+
+	// Running statistics of the current window
+	int32_t 		min 	= INT32_MAX;
+	int32_t 		max 	= INT32_MIN;
+	int64_t 		sum 	= 0;
+	int64_t 		sumSq 	= 0;
+	uint32_t 		count 	= 0;
+};
+
+/** Global Variables **/
+static ChannelState channelStates[XADC_IDX_COUNT];
+
+/**
+ * @brief	Feeds a sample to the decimator
+ * @param	output	Decimated sample, valid only if true is returned
+ * @return	true if a decimated sample is produced
+ */
+static bool Decimate(CicDecimator& cic, const int32_t sample, int32_t& output)
+{
+	// Integrators run at the input rate
+	uint64_t value = uint64_t(int64_t(sample));
+	for(uint64_t& integrator : cic.integrators)
+	{
+		integrator += value;
+		value = integrator;
+	}
+
+	if(++cic.phase < XADC_DSP_DECIMATION)
+		return false;
+
+	cic.phase = 0;
+
+	// Combs run at the output rate
+	for(uint64_t& delay : cic.combDelays)
+	{
+		const uint64_t previous = delay;
+		delay = value;
+		value -= previous;
+	}
+
+	// The filter starts from an all-zero history, first outputs belong to the step response
+	if(0 != cic.warmUp)
+	{
+		--cic.warmUp;
+
+		return false;
+	}
+
+	// Back to signed only here, where the value is within the output range
+	output = int32_t(int64_t(value) >> CIC_GAIN_SHIFT);
+
+	return true;
+}
+
+static void Accumulate(ChannelState& state, const int32_t sample)
+{
+	if(sample < state.min)
+		state.min = sample;
+
+	if(sample > state.max)
+		state.max = sample;
+
+	state.sum 	+= sample;
+	state.sumSq += int64_t(sample) * sample;
+	state.count += 1;
+
+	// Count each excursion once, at the moment the limits are exceeded
+	const bool b_outOfRange = (sample < state.lowerLimit) || (sample > state.upperLimit);
+
+	if(b_outOfRange && !state.b_outOfRange)
+		state.excursions += 1;
+
+	state.b_outOfRange = b_outOfRange;
+}
+
+void XadcDspSetLimits(XadcChannelIndex index, int32_t lower, int32_t upper)
+{
+	if((index >= XADC_IDX_COUNT) || (lower > upper))
+		while(1);
+
+	channelStates[index].lowerLimit = lower;
+	channelStates[index].upperLimit = upper;
+}
+
+void XadcDspProcess(XadcChannelIndex index, const int32_t* converted, size_t count)
+{
+	if(index >= XADC_IDX_COUNT)
+		return;
+
+	ChannelState& state = channelStates[index];
+	int32_t decimated = 0;
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		if(Decimate(state.cic, converted[idx], decimated))
+			Accumulate(state, decimated);
+	}
+}
+
+XadcSummary XadcDspTakeSummary(XadcChannelIndex index)
+{
+	XadcSummary summary;
+
+	if(index >= XADC_IDX_COUNT)
+		return summary;
+
+	ChannelState& state = channelStates[index];
+
+	summary.count 			= state.count;
+	summary.excursions 		= state.excursions;
+	summary.b_outOfRange 	= state.b_outOfRange;
+
+	if(0 != state.count)
+	{
+		summary.min 	= state.min;
+		summary.max 	= state.max;
+		summary.mean 	= int32_t(state.sum / state.count);
+		summary.rms 	= int32_t(sqrt(double(state.sumSq) / state.count));
+	}
+
+	// Start a new window, the decimator and the threshold state continue
+	state.min 			= INT32_MAX;
+	state.max 			= INT32_MIN;
+	state.sum 			= 0;
+	state.sumSq 		= 0;
+	state.count 		= 0;
+	state.excursions 	= 0;
+
+	return summary;
+}
@@ -0,0 +1,36 @@
+/**
+ * @brief	  	Streaming decimation, statistics and threshold detection of XADC channels
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Converted samples of each channel go through a CIC decimator first. Decimated
+ * 				samples update the running statistics of the current summary window and are
+ * 				compared against the channel limits. Everything is computed incrementally,
+ * 				no sample history is kept. The application exports a compact summary per
+ * 				channel instead of the raw samples.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "XadcAcquisition.h"
+
+/** Definitions **/
+#define XADC_DSP_CIC_ORDER		3	// Number of integrator and comb stages
+#define XADC_DSP_DECIMATION		8	// Decimation ratio, must be a power of two
+
+/** Custom Structures **/
+struct XadcSummary{
+	int32_t 	min			= 0;		// Output units of the conversion (uV or mC)
+	int32_t 	max			= 0;
+	int32_t 	mean		= 0;
+	int32_t 	rms			= 0;
+	uint32_t 	count		= 0;		// Number of decimated samples in the window
+	uint32_t 	excursions	= 0;		// Number of times the limits were exceeded
+	bool 		b_outOfRange = false;	// State at the end of the window
+};
+
+/** Function Declarations **/
+void 		XadcDspSetLimits(XadcChannelIndex index, int32_t lower, int32_t upper);	// Threshold detection limits
+void 		XadcDspProcess(XadcChannelIndex index, const int32_t* converted, size_t count);
+XadcSummary XadcDspTakeSummary(XadcChannelIndex index);								// Returns the window and starts a new one
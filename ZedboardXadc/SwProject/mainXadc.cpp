@@ -2,16 +2,166 @@
  * @brief	  Main software file for using XADC monitor on Zedboard
  * @author	Caglayan DOKME, caglayandokme@gmail.com
  * @date	  September 24, 2021 -> Created
+ * 			  October 19, 2026 -> Timer paced, buffered acquisition added.
+ * 			  October 19, 2026 -> Fixed-point calibrated conversion added.
+ * 			  October 19, 2026 -> Decimation, statistics and limit checks added.
+ * 			  October 19, 2026 -> Hardware alarms added.
+ * 			  October 19, 2026 -> GIC vector table added.
+ * 			  October 19, 2026 -> Binary telemetry of the raw samples added.
+ * 			  October 19, 2026 -> Telemetry decimated and queued into a non-blocking TX ring.
+ * 			  October 19, 2026 -> Conversion benchmark made optional.
+ * 			  October 19, 2026 -> Text report and its accounting left out of the telemetry builds.
  */
 
 /** Libraries **/
 #include "xparameters.h"
 #include "xadcps.h"
-#include "sleep.h"
+#include "xscutimer.h"
+#include "xscugic.h"
+#include "GicVectorTable.h"
+#include "xtime_l.h"
+#include "XadcAcquisition.h"
+#include "XadcCalibration.h"
+#include "XadcDsp.h"
+#include "XadcAlarm.h"
 #include <stdio.h>
 
+#ifdef XADC_TELEMETRY
+#include "xuartps_hw.h"
+#include "Telemetry.h"
+#include "RingBuffer.h"
+#endif
+
+/** Definitions **/
+// The private timer is clocked half the CPU frequency
+#define TIMER_1S_VALUE 		(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2)
+
+#define CONVERSION_BLOCK_SIZE	64		// Number of samples converted in one go
+#define TEMP_ALARM_HYSTERESIS_MC	5000	// Temperature alarm resets 5C below its limit
+#define ALARM_LINE_SIZE			160
+
+#ifdef XADC_TELEMETRY
+// All the raw samples (8 channels at 1kHz) don't fit into the serial link, every Nth is streamed
+#define TELEMETRY_BAUD_RATE		115200
+#define TELEMETRY_DECIMATION	4
+#define TELEMETRY_FRAME_SAMPLES	32		// Samples of a channel collected into a frame
+#define TELEMETRY_TX_RING_SIZE	4096	// Must be a power of two
+
+// A byte is 10 bits on the line, a quarter of the link is left for the alarm reports
+static_assert((TELEMETRY_FRAME_SIZE(2 + (2 * TELEMETRY_FRAME_SAMPLES)) * XADC_IDX_COUNT * XADC_ACQ_SEQUENCE_RATE_HZ) /
+			  (TELEMETRY_DECIMATION * TELEMETRY_FRAME_SAMPLES) <= ((TELEMETRY_BAUD_RATE / 10) * 3) / 4, "Telemetry exceeds the serial link!");
+static_assert(TELEMETRY_FRAME_SAMPLES <= TELEMETRY_MAX_SAMPLES, "Samples must fit into a single frame!");
+#endif
+
+/** Custom Structures **/
+struct ChannelMonitor{
+	const char* name;
+	int32_t 	lowerLimit;		// uV or mC
+	int32_t 	upperLimit;		// uV or mC
+};
+
 /** Driver Instances **/
 XAdcPs adc;
+XScuTimer timer;
+XScuGic gic;
+
+/** Global Variables **/
+// Nominal rails of Zedboard with 5% tolerance, ordered as XadcChannelIndex
+const ChannelMonitor channelMonitors[XADC_IDX_COUNT] = {
+	{"TEMP", 	 0, 		85000	},
+	{"VCCINT", 	 950000, 	1050000	},
+	{"VCCAUX", 	 1710000, 	1890000	},
+	{"VBRAM", 	 950000, 	1050000	},
+	{"VCCPINT",  950000, 	1050000	},
+	{"VCCPAUX",  1710000, 	1890000	},
+	{"VCCPDRO",  1425000, 	1575000	},
+	{"VP-VN", 	 0, 		1000000	}
+};
+
+#ifdef XADC_TELEMETRY
+RingBuffer<uint8_t, TELEMETRY_TX_RING_SIZE> telemetryRing;	// Drained into the UART by the application loop
+TelemetrySamples 	telemetryPending[XADC_IDX_COUNT];		// Decimated samples waiting for a full frame
+uint8_t 			telemetryPhase[XADC_IDX_COUNT] = {0};
+
+/**
+ * @brief	Collects every TELEMETRY_DECIMATION-th raw sample, a full frame is queued into the TX ring
+ */
+void QueueSamples(XadcChannelIndex index, const uint16_t* raw, size_t count)
+{
+	TelemetrySamples& pending 	= telemetryPending[index];
+	uint8_t& phase 				= telemetryPhase[index];
+
+	for(size_t idx = 0; idx < count; ++idx)
+	{
+		const bool b_taken = (0 == phase);
+		phase = uint8_t((phase + 1) % TELEMETRY_DECIMATION);
+
+		if(!b_taken)
+			continue;
+
+		pending.samples[pending.count++] = raw[idx];
+
+		if(pending.count < TELEMETRY_FRAME_SAMPLES)
+			continue;
+
+		XTime now = 0;
+		XTime_GetTime(&now);
+
+		// A frame that doesn't fit is dropped, the receiver sees a gap in the sequence
+		pending.channel = index;
+		telemetryRing.Commit(TelemetryEncodeSamples(telemetryRing, uint32_t(now), pending));
+		pending.count = 0;
+	}
+}
+
+/**
+ * @brief	Queues a text line between the frames, the decoder passes it through
+ */
+void QueueText(const char* text, size_t size)
+{
+	// The text and its delimiter go as a whole or not at all
+	if(telemetryRing.Free() < (size + 1))
+		return;
+
+	telemetryRing.Write(reinterpret_cast<const uint8_t*>(text), size);
+	telemetryRing.Push(TELEMETRY_DELIMITER);
+}
+
+/**
+ * @brief	Moves the queued bytes into the UART while its TX FIFO has room, never waits
+ */
+void DrainTelemetry()
+{
+	uint8_t byte = 0;
+
+	while(!XUartPs_IsTransmitFull(STDOUT_BASEADDRESS) && telemetryRing.Pop(byte))
+		XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_FIFO_OFFSET, byte);
+}
+#endif
+
+/**
+ * @brief	Formats the report of an alarm event as a single line
+ * @return	Length of the line
+ */
+size_t FormatAlarm(const XadcAlarmEvent& alarm, char* line, size_t size)
+{
+	size_t length = snprintf(line, size, "ALARM at %u us:", unsigned(alarm.timestamp / (COUNTS_PER_SECOND / 1000000)));
+
+	for(uint8_t idx = 0; (idx < XADC_IDX_COUNT) && (length < size); ++idx)
+	{
+		if(0 != (alarm.sources & XadcAlarmSourceOf(XadcChannelIndex(idx))))
+			length += snprintf(line + length, size - length, " %s", channelMonitors[idx].name);
+	}
+
+	if((0 != (alarm.sources & XADCPS_INTX_OT_MASK)) && (length < size))
+		length += snprintf(line + length, size - length, " OVER-TEMPERATURE");
+
+	if(length < size)
+		length += snprintf(line + length, size - length, "\r\n");
+
+	// Truncated if it doesn't fit
+	return (length < size) ? length : (size - 1);
+}
 
 /**
  * @brief	Initializes the XADC component
@@ -48,52 +198,193 @@ void InitXadc()
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	// Disable all alarms
-	XAdcPs_SetAlarmEnables(&adc, 0);
+	// Hardware alarms use the same limits as the software checks
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+	{
+		const int32_t upper = channelMonitors[idx].upperLimit;
+		int32_t lower 		= channelMonitors[idx].lowerLimit;
+
+		// Lower threshold of the temperature alarm is its reset point
+		if(XADC_IDX_TEMP == idx)
+			lower = upper - TEMP_ALARM_HYSTERESIS_MC;
+
+		XadcAlarmSetLimits(&adc, XadcChannelIndex(idx), lower, upper);
+	}
+
+	XadcAlarmInit(&adc);
 
 	// Sequencer can be activated after enabling the required channels
 	XAdcPs_SetSequencerMode(&adc, XADCPS_SEQ_MODE_CONTINPASS);
+
+	// Conversion uses the calibration coefficients measured by the device
+	XadcCalibLoadFromDevice(&adc);
+
+	// Acquisition reads the channels only from now on
+	XadcAcqInit(&adc);
+}
+
+/**
+ * @brief	Initializes the private timer which paces the acquisition
+ */
+void InitTimer()
+{
+	uint32_t errCode = 0;
+
+	// Find the related configuration
+	XScuTimer_Config* config = XScuTimer_LookupConfig(XPAR_PS7_SCUTIMER_0_DEVICE_ID);
+
+	// Check if the configuration is found
+	if(nullptr == config)
+		while(1);
+
+	// Initialize the driver using the given configuration
+	errCode = XScuTimer_CfgInitialize(&timer, config, config->BaseAddr);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	// Make a self-test to driver initially
+	errCode = XScuTimer_SelfTest(&timer);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	// A sequence is read at each expiry
+	XScuTimer_EnableAutoReload(&timer);
+	XScuTimer_LoadTimer(&timer, TIMER_1S_VALUE / XADC_ACQ_SEQUENCE_RATE_HZ);
+
+	// Enable IRQ generation
+	XScuTimer_EnableInterrupt(&timer);
+}
+
+/**
+ * @brief	Initializes the interrupt controller
+ */
+// Interrupt vector table
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(XPAR_PS7_SCUTIMER_0_INTR, 	XadcAcqIrqHandler, 		&timer),	// Acquisition pacing
+	GIC_BIND(XPS_SYSMON_INT_ID, 		XadcAlarmIrqHandler, 	&adc)		// Hardware alarms
+};
+
+void InitGic()
+{
+	uint32_t errCode = 0;
+
+	errCode = GicInit(&gic);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	GicStart();
 }
 
 int main()
 {
-	// Initialization of the XADC component
+	// Initialization of the XADC component and the acquisition
 	InitXadc();
+	InitTimer();
+	InitGic();
+
+#ifdef XADC_CALIB_BENCHMARK
+	// Fixed-point conversion versus the BSP's float conversion
+	XadcCalibBenchmark();
+#endif
+
+#ifndef XADC_TELEMETRY
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		XadcDspSetLimits(XadcChannelIndex(idx), channelMonitors[idx].lowerLimit, channelMonitors[idx].upperLimit);
+#endif
 
-	// Real values of monitored sensors
-	float vccInt = 0, vccAux = 0, vBram = 0, vccPint = 0, vccPaux = 0, vddR = 0, vpvn = 0, temp = 0;
+	XScuTimer_Start(&timer);
+
+	uint16_t rawBlock[CONVERSION_BLOCK_SIZE];
+
+#ifndef XADC_TELEMETRY
+	// Number of samples received in the current second
+	uint32_t sampleCounts[XADC_IDX_COUNT] = {0};
+
+	int32_t convertedBlock[CONVERSION_BLOCK_SIZE];
+
+	XTime now = 0, lastReport = 0;
+	XTime_GetTime(&lastReport);
+#endif
 
 	// Application loop
 	while(1)
 	{
-		// Read all monitored values and convert them to actual values
-		temp	= XAdcPs_RawToTemperature(XAdcPs_GetAdcData(&adc, XADCPS_CH_TEMP));
-		vccInt 	= XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VCCINT)	);
-		vccAux 	= XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VCCAUX)	);
-		vBram 	= XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VBRAM)	);
-		vddR 	= XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VCCPDRO));
-		vccPint = XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VCCPINT));
-		vccPaux = XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VCCPAUX));
-		vpvn 	= XAdcPs_RawToVoltage(XAdcPs_GetAdcData(&adc, XADCPS_CH_VPVN)	);
-
-		// Somehow the converted value is non-calibrated
-		vpvn 	= (vpvn / 1.88) * 0.64;
-
-		// Some of the values can be monitored via serial port
-		printf("VCC INT: %f\r\n", 	vccInt);
-		printf("VP-VN: %f\r\n", 	vpvn);
-		printf("\n\r");
+		// Drain the buffered raw samples, convert and process them in blocks
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			const XadcChannelIndex index = XadcChannelIndex(idx);
+			size_t count = 0;
 
-		sleep(1);
-	}
+			while(0 != (count = XadcAcqRead(index, rawBlock, CONVERSION_BLOCK_SIZE)))
+			{
+#ifdef XADC_TELEMETRY
+				// Converted and summarized on the host
+				QueueSamples(index, rawBlock, count);
+#else
+				XadcConvertBlock(index, rawBlock, convertedBlock, count);
 
-	// Suppress the unused variable warning
-	(void) vccInt;
-	(void) vccAux;
-	(void) vBram;
-	(void) vccPint;
-	(void) vccPaux;
-	(void) vddR;
-	(void) vpvn;
-	(void) temp;
+				XadcDspProcess(index, convertedBlock, count);
+
+				sampleCounts[idx] += count;
+#endif
+			}
+		}
+
+		// Alarms are reported as soon as they are noticed
+		XadcAlarmEvent alarm;
+		while(XadcAlarmRead(alarm))
+		{
+			char line[ALARM_LINE_SIZE];
+			const size_t length = FormatAlarm(alarm, line, sizeof(line));
+
+#ifdef XADC_TELEMETRY
+			// Written directly, the text would split a frame in flight
+			QueueText(line, length);
+#else
+			printf("%.*s", int(length), line);
+#endif
+		}
+
+		XadcAlarmService();
+
+#ifdef XADC_TELEMETRY
+		// The samples themselves are streamed, the text report would corrupt the frames
+		DrainTelemetry();
+#else
+		XTime_GetTime(&now);
+		if((now - lastReport) < COUNTS_PER_SECOND)
+			continue;
+
+		lastReport = now;
+
+		// A single summary line per channel (mV or mC) instead of the raw samples
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			const XadcSummary summary = XadcDspTakeSummary(XadcChannelIndex(idx));
+
+			printf("%-8s min %d mean %d max %d rms %d exc %u%s\r\n",
+					channelMonitors[idx].name,
+					int(summary.min / 1000), int(summary.mean / 1000), int(summary.max / 1000), int(summary.rms / 1000),
+					unsigned(summary.excursions), summary.b_outOfRange ? " OUT OF RANGE" : "");
+		}
+
+		// Achieved sample rate of each channel during the last second
+		printf("Samples/s:");
+		uint32_t lostSamples = 0;
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			printf(" %u", unsigned(sampleCounts[idx]));
+			sampleCounts[idx] = 0;
+
+			lostSamples += XadcAcqOverflows(XadcChannelIndex(idx));
+		}
+
+		printf(" (lost %u)\r\n", unsigned(lostSamples));
+		printf("\n\r");
+#endif
+	}
 }
@@ -0,0 +1,58 @@
+/**
+ * @brief	  	Shared memory layout and workload of the dual-core example
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		CPU1 acquires, CPU0 processes. Samples cross the cores in blocks through a
+ * 				single queue placed in the shared memory, CPU0 commands CPU1 through the
+ * 				command word next to it.
+ *
+ * 				The benchmark workload stands for a mixed system: the acquisition side runs a
+ * 				per-sample cost similar to servicing a converter (register reads, scaling), the
+ * 				processing side runs a FIR filter and the energy of each block. Both images and
+ * 				the host emulation run the very same functions, thus their checksums must match.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "AmpQueue.h"
+
+/** Definitions **/
+#define AMP_BLOCK_SAMPLES 		64
+#define AMP_QUEUE_DEPTH 		32			// Blocks, must be a power of two
+
+#define WORKLOAD_ACQUIRE_ROUNDS 7			// Tunes the per-sample cost of the acquisition
+#define WORKLOAD_FIR_TAPS 		16
+
+/** Custom Structures **/
+struct AmpBlock{
+	uint32_t sequence;
+	uint16_t channel;
+	uint16_t count;
+	uint16_t samples[AMP_BLOCK_SAMPLES];
+};
+
+enum AmpCommand : uint32_t{
+	AMP_CMD_IDLE = 0,
+	AMP_CMD_BENCHMARK,		// Produce "argument" workload blocks
+	AMP_CMD_ACQUIRE			// Run the XADC acquisition
+};
+
+struct AmpApplicationShared{
+	volatile uint32_t 					command;		// Written by CPU0, CPU1 sets it back to idle
+	volatile uint32_t 					argument;
+	AmpQueue<AmpBlock, AMP_QUEUE_DEPTH> blocks;			// CPU1 -> CPU0
+};
+
+struct WorkloadState{
+	int32_t 	history[WORKLOAD_FIR_TAPS];
+	uint8_t 	position;
+	uint64_t 	energy;
+	uint32_t 	checksum;
+};
+
+/** Function Declarations **/
+void WorkloadAcquire(AmpBlock& block, uint32_t sequence);			// Fills a block, acquisition side
+void WorkloadProcess(const AmpBlock& block, WorkloadState& state);	// Consumes a block, processing side
+void WorkloadReset(WorkloadState& state);
@@ -0,0 +1,67 @@
+/**
+ * @brief	  	Mixed benchmark workload of the dual-core example
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "AmpApplication.h"
+#include <string.h>
+
+/** Global Variables **/
+// Low pass, Q15
+static const int16_t firCoefficients[WORKLOAD_FIR_TAPS] = {
+	 -64, 	-128, 	 96, 	 768, 	1920, 	3328, 	4480, 	 4992,
+	4992, 	4480, 	3328, 	1920, 	 768, 	  96, 	-128, 	 -64
+};
+
+void WorkloadAcquire(AmpBlock& block, uint32_t sequence)
+{
+	uint32_t state = (sequence * 2654435761u) | 1;
+
+	block.sequence 	= sequence;
+	block.channel 	= uint16_t(sequence & 0x7);
+	block.count 	= AMP_BLOCK_SAMPLES;
+
+	for(uint16_t idx = 0; idx < AMP_BLOCK_SAMPLES; ++idx)
+	{
+		// Stands for the register accesses and the scaling of a converter readout
+		for(uint8_t round = 0; round < WORKLOAD_ACQUIRE_ROUNDS; ++round)
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+		}
+
+		// Triangle with noise, left aligned 12 bits like the XADC results
+		const uint32_t phase 	= (sequence * AMP_BLOCK_SAMPLES + idx) & 0x3FF;
+		const uint32_t triangle = (phase < 0x200) ? (phase << 2) : ((0x3FF - phase) << 2);
+
+		block.samples[idx] = uint16_t(((triangle + (state & 0x3F)) & 0xFFF) << 4);
+	}
+}
+
+void WorkloadProcess(const AmpBlock& block, WorkloadState& state)
+{
+	for(uint16_t idx = 0; idx < block.count; ++idx)
+	{
+		state.history[state.position] = block.samples[idx];
+		state.position = (state.position + 1) % WORKLOAD_FIR_TAPS;
+
+		int32_t accumulator = 0;
+		for(uint8_t tap = 0; tap < WORKLOAD_FIR_TAPS; ++tap)
+			accumulator += firCoefficients[tap] * state.history[(state.position + tap) % WORKLOAD_FIR_TAPS];
+
+		const int32_t filtered = accumulator >> 15;
+
+		state.energy 	+= uint64_t(int64_t(filtered) * filtered);
+		state.checksum 	 = (state.checksum * 31) + uint32_t(filtered);
+	}
+
+	state.checksum ^= block.sequence;
+}
+
+void WorkloadReset(WorkloadState& state)
+{
+	memset(&state, 0, sizeof(state));
+}
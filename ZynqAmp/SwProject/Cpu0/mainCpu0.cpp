@@ -0,0 +1,257 @@
+/**
+ * @brief	  	Main software file of CPU0 in the dual-core example, the processing side
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		CPU0 owns the shared resources. It initializes the shared memory and the GIC
+ * 				distributor, starts CPU1 and configures the XADC. First, the mixed workload is
+ * 				run on CPU0 alone and then split between the cores to measure the scaling.
+ * 				Afterwards, CPU1 acquires the XADC channels and CPU0 converts and filters them.
+ */
+
+/** Libraries **/
+#include "xparameters.h"
+#include "xadcps.h"
+#include "xscugic.h"
+#include "xtime_l.h"
+#include "GicVectorTable.h"
+#include "AmpCore.h"
+#include "AmpApplication.h"
+#include "XadcAcquisition.h"
+#include "XadcCalibration.h"
+#include "XadcDsp.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define BENCHMARK_BLOCKS 		2000
+
+/** Driver Instances **/
+XAdcPs adc;
+XScuGic gic;
+
+/** Global Variables **/
+static const char* const channelNames[XADC_IDX_COUNT] = {
+	"TEMP", "VCCINT", "VCCAUX", "VBRAM", "VCCPINT", "VCCPAUX", "VCCPDRO", "VP-VN"
+};
+
+/**
+ * @brief	Initializes the interrupt controller
+ */
+// Interrupt vector table
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(AMP_DOORBELL_SGI_ID, AmpDoorbellIrqHandler, &ampDoorbell)		// Blocks from CPU1
+};
+
+void InitGic()
+{
+	uint32_t errCode = 0;
+
+	// Distributor is initialized here, CPU1 only uses its CPU interface
+	errCode = GicInit(&gic);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	GicStart();
+}
+
+/**
+ * @brief	Configures the XADC sequencer, CPU1 only reads the results
+ */
+void InitXadc()
+{
+	uint32_t errCode = 0;
+
+	// Find the hardware configuration for XADC component
+	XAdcPs_Config* config = XAdcPs_LookupConfig(XPAR_PS7_XADC_0_DEVICE_ID);
+
+	// Check if the configuration found successfully
+	if(nullptr == config)
+		while(1);
+
+	// Initialize the driver using the given configuration
+	errCode = XAdcPs_CfgInitialize(&adc, config, XPAR_PS7_XADC_0_BASEADDR);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	// Test the component initially
+	errCode = XAdcPs_SelfTest(&adc);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	// Sequencer must be in the SAFE mode before enabling any of the channels
+	XAdcPs_SetSequencerMode(&adc, XADCPS_SEQ_MODE_SAFE);
+
+	// Enable requested channels
+	errCode = XAdcPs_SetSeqChEnables(&adc, 	XADCPS_SEQ_CH_TEMP 		| XADCPS_SEQ_CH_VCCINT 	| XADCPS_SEQ_CH_VCCAUX 	|
+											XADCPS_SEQ_CH_VBRAM 	| XADCPS_SEQ_CH_VCCPINT | XADCPS_SEQ_CH_VCCPAUX |
+											XADCPS_SEQ_CH_VCCPDRO 	| XADCPS_SEQ_CH_VPVN);
+
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	XAdcPs_SetSequencerMode(&adc, XADCPS_SEQ_MODE_CONTINPASS);
+
+	// Conversion uses the calibration coefficients measured by the device
+	XadcCalibLoadFromDevice(&adc);
+}
+
+/**
+ * @brief	Passes a command to CPU1 and wakes it up
+ */
+void SendCommand(AmpApplicationShared& shared, AmpCommand command, uint32_t argument)
+{
+	shared.argument = argument;
+
+	AMP_BARRIER();
+	shared.command = command;
+
+	AmpNotify(&gic, AMP_CPU1);
+}
+
+uint32_t RunSingle(uint32_t blocks)
+{
+	WorkloadState state;
+	WorkloadReset(state);
+
+	AmpBlock block;
+	for(uint32_t sequence = 0; sequence < blocks; ++sequence)
+	{
+		WorkloadAcquire(block, sequence);
+		WorkloadProcess(block, state);
+	}
+
+	return state.checksum;
+}
+
+uint32_t RunAmp(AmpApplicationShared& shared, uint32_t blocks)
+{
+	WorkloadState state;
+	WorkloadReset(state);
+
+	shared.blocks.Reset();
+	SendCommand(shared, AMP_CMD_BENCHMARK, blocks);
+
+	uint32_t processed = 0;
+	while(processed < blocks)
+	{
+		// Read before the queue, a block committed afterwards rings the doorbell again
+		const uint32_t rings 	= ampDoorbell.rings;
+		const AmpBlock* block 	= shared.blocks.Peek();
+
+		if(nullptr == block)
+		{
+			AmpWait(ampDoorbell, rings);
+			continue;
+		}
+
+		// Processed in place, the slot is handed back afterwards
+		WorkloadProcess(*block, state);
+		shared.blocks.Release();
+		++processed;
+	}
+
+	return state.checksum;
+}
+
+void RunBenchmark(AmpApplicationShared& shared)
+{
+	XTime start = 0, singleTicks = 0, ampTicks = 0;
+
+	XTime_GetTime(&start);
+	const uint32_t singleChecksum = RunSingle(BENCHMARK_BLOCKS);
+	XTime_GetTime(&singleTicks);
+	singleTicks -= start;
+
+	XTime_GetTime(&start);
+	const uint32_t ampChecksum = RunAmp(shared, BENCHMARK_BLOCKS);
+	XTime_GetTime(&ampTicks);
+	ampTicks -= start;
+
+	const uint32_t samples = BENCHMARK_BLOCKS * AMP_BLOCK_SAMPLES;
+
+	printf("AMP benchmark, %u blocks of %u samples:\r\n", unsigned(BENCHMARK_BLOCKS), unsigned(AMP_BLOCK_SAMPLES));
+	printf("  single core  %8u us  %8u samples/s  checksum %08x\r\n",
+			unsigned(singleTicks / (COUNTS_PER_SECOND / 1000000)), unsigned((samples * XTime(COUNTS_PER_SECOND)) / singleTicks), unsigned(singleChecksum));
+	printf("  dual core    %8u us  %8u samples/s  checksum %08x\r\n",
+			unsigned(ampTicks / (COUNTS_PER_SECOND / 1000000)), unsigned((samples * XTime(COUNTS_PER_SECOND)) / ampTicks), unsigned(ampChecksum));
+	printf("  speedup      %u.%02ux%s\r\n",
+			unsigned(singleTicks / ampTicks), unsigned(((singleTicks * 100) / ampTicks) % 100),
+			(singleChecksum == ampChecksum) ? "" : " (CHECKSUM MISMATCH)");
+}
+
+int main()
+{
+	InitGic();
+
+	// Shared memory must be ready before CPU1 runs
+	AmpInitShared();
+	AmpApplicationShared& shared = AmpShared<AmpApplicationShared>();
+
+	if(!AmpStartCpu1())
+	{
+		printf("CPU1 didn't start, check the boot image and the memory map\r\n");
+		while(1);
+	}
+
+	RunBenchmark(shared);
+
+	// Acquisition moves to CPU1 once the XADC is configured
+	InitXadc();
+	SendCommand(shared, AMP_CMD_ACQUIRE, 0);
+
+	// Number of samples received in the current second
+	uint32_t sampleCounts[XADC_IDX_COUNT] = {0};
+	int32_t  convertedBlock[AMP_BLOCK_SAMPLES];
+
+	XTime now = 0, lastReport = 0;
+	XTime_GetTime(&lastReport);
+
+	// Application loop
+	while(1)
+	{
+		const uint32_t rings 	= ampDoorbell.rings;
+		const AmpBlock* block 	= shared.blocks.Peek();
+
+		if(nullptr != block)
+		{
+			const XadcChannelIndex index 	= XadcChannelIndex(block->channel);
+			const size_t count 				= block->count;
+
+			// Slot is handed back as soon as the raw samples are converted
+			XadcConvertBlock(index, block->samples, convertedBlock, count);
+			shared.blocks.Release();
+
+			XadcDspProcess(index, convertedBlock, count);
+			sampleCounts[index] += count;
+			continue;
+		}
+
+		XTime_GetTime(&now);
+		if((now - lastReport) < COUNTS_PER_SECOND)
+		{
+			// Blocks arrive many times a second, the next one wakes the core up
+			AmpWait(ampDoorbell, rings);
+			continue;
+		}
+
+		lastReport = now;
+
+		// A single summary line per channel (mV or mC)
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			const XadcSummary summary = XadcDspTakeSummary(XadcChannelIndex(idx));
+
+			printf("%-8s min %d mean %d max %d rms %d samples/s %u\r\n", channelNames[idx],
+					int(summary.min / 1000), int(summary.mean / 1000), int(summary.max / 1000), int(summary.rms / 1000),
+					unsigned(sampleCounts[idx]));
+
+			sampleCounts[idx] = 0;
+		}
+
+		printf("Blocks lost between the cores: %u\r\n\n", unsigned(shared.blocks.Overflows()));
+	}
+}
@@ -0,0 +1,185 @@
+/**
+ * @brief	  	Main software file of CPU1 in the dual-core example, the acquisition side
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		The BSP of this image must be built with -DUSE_AMP=1. CPU1 never touches the
+ * 				GIC distributor, the L2 cache or the XADC configuration, they belong to CPU0.
+ * 				The private timer is banked, this one paces the acquisition of CPU1 only.
+ */
+
+/** Libraries **/
+#include "xparameters.h"
+#include "xadcps.h"
+#include "xscutimer.h"
+#include "xscugic.h"
+#include "xpseudo_asm.h"
+#include "GicVectorTable.h"
+#include "AmpCore.h"
+#include "AmpApplication.h"
+#include "XadcAcquisition.h"
+
+/** Definitions **/
+// The private timer is clocked half the CPU frequency
+#define TIMER_1S_VALUE 		(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2)
+
+/** Driver Instances **/
+XAdcPs adc;
+XScuTimer timer;
+XScuGic gic;
+
+/**
+ * @brief	Initializes the private timer which paces the acquisition
+ */
+void InitTimer()
+{
+	uint32_t errCode = 0;
+
+	// Find the related configuration
+	XScuTimer_Config* config = XScuTimer_LookupConfig(XPAR_PS7_SCUTIMER_0_DEVICE_ID);
+
+	// Check if the configuration is found
+	if(nullptr == config)
+		while(1);
+
+	// Initialize the driver using the given configuration
+	errCode = XScuTimer_CfgInitialize(&timer, config, config->BaseAddr);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	// A sequence is read at each expiry
+	XScuTimer_EnableAutoReload(&timer);
+	XScuTimer_LoadTimer(&timer, TIMER_1S_VALUE / XADC_ACQ_SEQUENCE_RATE_HZ);
+
+	// Enable IRQ generation
+	XScuTimer_EnableInterrupt(&timer);
+}
+
+/**
+ * @brief	Initializes the interrupt controller
+ */
+// Interrupt vector table
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(AMP_DOORBELL_SGI_ID, 		AmpDoorbellIrqHandler, 	&ampDoorbell),	// Commands from CPU0
+	GIC_BIND(XPAR_PS7_SCUTIMER_0_INTR, 	XadcAcqIrqHandler, 		&timer)			// Acquisition pacing
+};
+
+void InitGic()
+{
+	uint32_t errCode = 0;
+
+	// The self test would read the distributor, which is being used by CPU0
+	errCode = GicInit(&gic, false);
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
+	if(XST_SUCCESS != errCode)
+		while(1);
+
+	GicStart();
+}
+
+/**
+ * @brief	Produces the benchmark blocks as fast as CPU0 consumes them
+ */
+void Produce(AmpApplicationShared& shared, uint32_t blocks)
+{
+	for(uint32_t sequence = 0; sequence < blocks; ++sequence)
+	{
+		AmpBlock* slot = nullptr;
+
+		// CPU0 doesn't notify freed slots, the queue is short enough to spin on
+		while(nullptr == (slot = shared.blocks.Claim()));
+
+		// Filled in place, no copy through the shared memory
+		WorkloadAcquire(*slot, sequence);
+		shared.blocks.Commit();
+
+		AmpNotify(&gic, AMP_CPU0);
+	}
+}
+
+/**
+ * @brief	Acquires the XADC channels and passes them to CPU0 block by block
+ */
+void Acquire(AmpApplicationShared& shared)
+{
+	// CPU0 has configured the sequencer, only the driver instance is set up here
+	XAdcPs_Config* config = XAdcPs_LookupConfig(XPAR_PS7_XADC_0_DEVICE_ID);
+	if(nullptr == config)
+		while(1);
+
+	if(XST_SUCCESS != XAdcPs_CfgInitialize(&adc, config, XPAR_PS7_XADC_0_BASEADDR))
+		while(1);
+
+	XadcAcqInit(&adc);
+	XScuTimer_Start(&timer);
+
+	// Partially filled block of each channel
+	AmpBlock pending[XADC_IDX_COUNT];
+	uint32_t sequence = 0;
+
+	for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+	{
+		pending[idx].channel 	= idx;
+		pending[idx].count 		= 0;
+	}
+
+	while(1)
+	{
+		for(uint8_t idx = 0; idx < XADC_IDX_COUNT; ++idx)
+		{
+			AmpBlock& block = pending[idx];
+
+			block.count += XadcAcqRead(XadcChannelIndex(idx), &block.samples[block.count], AMP_BLOCK_SAMPLES - block.count);
+
+			if(AMP_BLOCK_SAMPLES != block.count)
+				continue;
+
+			// A full queue drops the block, CPU0 reports the overflows
+			block.sequence = sequence++;
+			if(shared.blocks.Push(block))
+				AmpNotify(&gic, AMP_CPU0);
+
+			block.count = 0;
+		}
+
+		// Next timer tick
+		wfi();
+	}
+}
+
+int main()
+{
+	InitTimer();
+	InitGic();
+
+	AmpApplicationShared& shared = AmpShared<AmpApplicationShared>();
+
+	// CPU0 waits for this before going on
+	AmpSignalReady();
+
+	while(1)
+	{
+		// Read before the command, a command written afterwards rings the doorbell again
+		const uint32_t rings = ampDoorbell.rings;
+
+		switch(shared.command)
+		{
+			case AMP_CMD_BENCHMARK:
+				shared.command = AMP_CMD_IDLE;
+				Produce(shared, shared.argument);
+				break;
+
+			case AMP_CMD_ACQUIRE:
+				shared.command = AMP_CMD_IDLE;
+				Acquire(shared);
+				break;
+
+			default:
+				AmpWait(ampDoorbell, rings);
+				break;
+		}
+	}
+}
@@ -0,0 +1,170 @@
+/**
+ * @brief	  	Host emulation and throughput benchmark of the dual-core example
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Two threads stand for the cores, the queue and the workload are the same code
+ * 				that runs on the Zynq. The doorbell is an atomic counter, the waiting thread
+ * 				yields instead of executing WFI. Build from the ZynqAmp folder:
+ * 				g++ -O2 -pthread -I../Common -ISwProject SwProject/AmpWorkload.cpp SwProject/HostSim/AmpHostSim.cpp -o amphost
+ */
+
+/** Libraries **/
+#include "AmpApplication.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdio.h>
+
+/** Definitions **/
+#define BENCHMARK_BLOCKS 	20000
+#define BENCHMARK_REPEATS 	5
+
+/** Custom Structures **/
+// Stands for the SGI doorbell of a core
+struct HostDoorbell{
+	std::atomic<uint32_t> rings{0};
+
+	void Notify()
+	{
+		rings.fetch_add(1, std::memory_order_release);
+	}
+
+	uint32_t Wait(uint32_t seen)
+	{
+		uint32_t current = 0;
+
+		while(seen == (current = rings.load(std::memory_order_acquire)))
+			std::this_thread::yield();
+
+		return current;
+	}
+};
+
+/** Global Variables **/
+static AmpApplicationShared shared;		// Zero initialized, i.e. empty queue
+static HostDoorbell 		doorbellCpu0;
+
+// Acquisition side, the loop of CPU1 for AMP_CMD_BENCHMARK
+static void Cpu1Produce(const uint32_t blocks)
+{
+	for(uint32_t sequence = 0; sequence < blocks; ++sequence)
+	{
+		AmpBlock* slot = nullptr;
+
+		while(nullptr == (slot = shared.blocks.Claim()))
+			std::this_thread::yield();
+
+		WorkloadAcquire(*slot, sequence);
+		shared.blocks.Commit();
+
+		doorbellCpu0.Notify();
+	}
+}
+
+static uint32_t RunSingle(const uint32_t blocks)
+{
+	WorkloadState state;
+	WorkloadReset(state);
+
+	AmpBlock block;
+	for(uint32_t sequence = 0; sequence < blocks; ++sequence)
+	{
+		WorkloadAcquire(block, sequence);
+		WorkloadProcess(block, state);
+	}
+
+	return state.checksum;
+}
+
+// Acquisition alone, to see how the workload splits between the cores
+static uint32_t RunAcquire(const uint32_t blocks)
+{
+	AmpBlock block;
+	uint32_t checksum = 0;
+
+	for(uint32_t sequence = 0; sequence < blocks; ++sequence)
+	{
+		WorkloadAcquire(block, sequence);
+		checksum += block.samples[sequence % AMP_BLOCK_SAMPLES];
+	}
+
+	return checksum;
+}
+
+static uint32_t RunAmp(const uint32_t blocks)
+{
+	WorkloadState state;
+	WorkloadReset(state);
+
+	shared.blocks.Reset();
+	std::thread cpu1(Cpu1Produce, blocks);
+
+	// Processing side, the loop of CPU0
+	uint32_t processed = 0;
+	while(processed < blocks)
+	{
+		const uint32_t rings = doorbellCpu0.rings.load(std::memory_order_acquire);
+		const AmpBlock* block = shared.blocks.Peek();
+
+		if(nullptr == block)
+		{
+			doorbellCpu0.Wait(rings);
+			continue;
+		}
+
+		WorkloadProcess(*block, state);
+		shared.blocks.Release();
+		++processed;
+	}
+
+	cpu1.join();
+
+	return state.checksum;
+}
+
+template<typename Function>
+static double BestOf(Function function, uint32_t& checksum)
+{
+	double best = 1e30;
+
+	for(uint8_t repeat = 0; repeat < BENCHMARK_REPEATS; ++repeat)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		checksum = function(BENCHMARK_BLOCKS);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		if(elapsed.count() < best)
+			best = elapsed.count();
+	}
+
+	return best;
+}
+
+int main()
+{
+	uint32_t singleChecksum = 0, ampChecksum = 0, acquireChecksum = 0;
+
+	const double singleTime 	= BestOf(RunSingle, singleChecksum);
+	const double acquireTime 	= BestOf(RunAcquire, acquireChecksum);
+	const double ampTime 	= BestOf(RunAmp, ampChecksum);
+
+	const double samples = double(BENCHMARK_BLOCKS) * AMP_BLOCK_SAMPLES;
+
+	printf("AMP host emulation, %u blocks of %u samples, best of %u:\n",
+			unsigned(BENCHMARK_BLOCKS), unsigned(AMP_BLOCK_SAMPLES), unsigned(BENCHMARK_REPEATS));
+	printf("  single core  %8.2f ms  %8.2f Msamples/s  checksum %08x\n", singleTime * 1e3, samples / singleTime / 1e6, unsigned(singleChecksum));
+	printf("  dual core    %8.2f ms  %8.2f Msamples/s  checksum %08x\n", ampTime * 1e3, samples / ampTime / 1e6, unsigned(ampChecksum));
+	printf("  speedup      %8.2fx\n", singleTime / ampTime);
+
+	// The slower side bounds the pipeline
+	const double processTime 	= singleTime - acquireTime;
+	const double boundTime 		= (acquireTime > processTime) ? acquireTime : processTime;
+	printf("  split        %8.1f%% acquisition, %.1f%% processing, %.2fx at best\n",
+			100.0 * acquireTime / singleTime, 100.0 * processTime / singleTime, singleTime / boundTime);
+
+	if(std::thread::hardware_concurrency() < 2)
+		printf("  the host has a single hardware thread, the dual core figure isn't meaningful\n");
+
+	return (singleChecksum == ampChecksum) ? 0 : 1;
+}
@@ -0,0 +1,307 @@
+/**
+ * @file 	IdleManagerSim.cpp
+ * @brief	Host simulation of the tickless idle manager with scripted workloads.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The idle manager is built as is on top of a simulated private timer, global timer
+ * 			and IRQ mask. Time only moves in WFI, in the callbacks (their work) and by a fixed
+ * 			cost of each application loop iteration, thus the deadlines, the wake-ups and the
+ * 			residency are exact and can be checked. Build from the ZynqPrivateTimer folder:
+ * 			g++ -ISwProject/HostSim -I../Common/HostSim -ISwProject SwProject/IdleManager.cpp SwProject/HostSim/IdleManagerSim.cpp -o idlesim
+ */
+
+/** Libraries **/
+#include "xscutimer.h"
+#include "xtime_l.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "IdleManager.h"
+#include "SimCheck.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define TICKS_PER_MS 	(COUNTS_PER_SECOND / 1000)
+#define LOOP_TICKS 		100							// Cost of an application loop iteration, about 300ns
+#define NO_EVENT 		UINT64_MAX
+
+/** Custom Structures **/
+// Expected schedule of a software timer and what the callbacks saw
+struct TimerRecord{
+	XTime 		expected 	= 0;		// Deadline of the next call
+	XTime 		period 		= 0;
+	XTime 		work 		= 0;		// Ticks spent in each call
+	XTime 		longWork 	= 0;		// Ticks spent in the call with the index below
+	uint32_t 	longCall 	= UINT32_MAX;
+	uint32_t 	calls 		= 0;
+	uint32_t 	lateCalls 	= 0;
+	XTime 		maxLateness = 0;
+	bool 		b_early 	= false;
+};
+
+/** Hardware Instances **/
+static XScuTimer timer;
+
+/** Global Variables **/
+static XTime 	nextExternalIrq = NO_EVENT;
+static uint32_t wfiCalls 		= 0;
+static uint32_t wfiUnmasked 	= 0;	// WFI entered with the IRQs unmasked, a wake-up could be lost
+static uint32_t timerIrqs 		= 0;
+
+static XTime Now()
+{
+	return GlobalTimerSimNow();
+}
+
+// Sleeps until the earliest of the private timer expiry and the scripted interrupt
+void WfiSim()
+{
+	++wfiCalls;
+
+	if(!ExceptionSimState().b_irqMasked)
+		++wfiUnmasked;
+
+	XTime wakeUp = timer.b_running ? ScuTimerSimExpiry(&timer) : NO_EVENT;
+	const bool b_external = (nextExternalIrq < wakeUp);
+
+	if(b_external)
+		wakeUp = nextExternalIrq;
+
+	// Nothing would ever wake the core up
+	if(NO_EVENT == wakeUp)
+	{
+		SimCheckPassed() = false;
+		return;
+	}
+
+	if(wakeUp > Now())
+		GlobalTimerSimNow() = wakeUp;
+
+	if(b_external)
+		nextExternalIrq = NO_EVENT;
+	else
+		ScuTimerSimExpire(&timer);
+
+	// Pending until the idle manager unmasks the IRQs
+	ExceptionSimRaise();
+}
+
+// Stands for the GIC, the private timer is the only interrupt with a handler
+static void IrqDispatch()
+{
+	if(0 != timer.interruptStatus)
+	{
+		++timerIrqs;
+		IdleTimerIrqHandler(&timer);
+	}
+}
+
+static void RecordCall(void* arguments)
+{
+	TimerRecord& record = *static_cast<TimerRecord*>(arguments);
+	const XTime now = Now();
+
+	if(now < record.expected)
+	{
+		record.b_early = true;
+	}
+	else
+	{
+		const XTime lateness = now - record.expected;
+
+		if(lateness > record.maxLateness)
+			record.maxLateness = lateness;
+
+		if(0 != lateness)
+			++record.lateCalls;
+	}
+
+	// Missed deadlines are skipped, the schedule stays on the grid of the period
+	if(0 != record.period)
+	{
+		do{
+			record.expected += record.period;
+		}while(record.expected <= now);
+	}
+
+	GlobalTimerSimAdvance((record.calls == record.longCall) ? record.longWork : record.work);
+	++record.calls;
+}
+
+static void Arm(SoftTimer& softTimer, TimerRecord& record, const XTime delay, const XTime period)
+{
+	record.expected 	= Now() + delay;
+	record.period 		= period;
+	softTimer.callback 	= RecordCall;
+	softTimer.arguments = &record;
+
+	if(!SoftTimerStart(softTimer, delay, period))
+		SimCheckPassed() = false;
+}
+
+// Application loop of the example, ends with the timers expiring at the given time served
+static void RunUntil(const XTime end)
+{
+	while(SimCheckPassed() && (Now() < end))
+	{
+		IdleProcessTimers();
+		GlobalTimerSimAdvance(LOOP_TICKS);
+		IdleEnter();
+	}
+
+	IdleProcessTimers();
+}
+
+static void CheckPeriodic()
+{
+	static SoftTimer 	softTimer;
+	static TimerRecord 	record;
+
+	printf("Periodic timer, 10ms period, 1ms work:\n");
+
+	record.work = TICKS_PER_MS;
+	Arm(softTimer, record, 10 * TICKS_PER_MS, 10 * TICKS_PER_MS);
+
+	const uint32_t startWfi = wfiCalls, startIrqs = timerIrqs;
+	RunUntil(Now() + (3000 * TICKS_PER_MS));
+
+	const IdleResidency residency 	= IdleGetResidency();
+	const double idleShare 			= double(residency.idleTicks) / double(residency.idleTicks + residency.activeTicks);
+
+	Check("every deadline served", 300 == record.calls);
+	Check("callbacks run on their deadlines", !record.b_early && (0 == record.maxLateness));
+	Check("a single wake-up for each deadline", ((wfiCalls - startWfi) == record.calls) && ((timerIrqs - startIrqs) == record.calls));
+	Check("WFI always entered with the IRQs masked", 0 == wfiUnmasked);
+	Check("residency window of a second", (residency.idleTicks + residency.activeTicks) >= COUNTS_PER_SECOND);
+	Check("wake-ups of the window", (residency.wakeUps >= 100) && (residency.wakeUps <= 101));
+	Check("idle share matches the workload", (idleShare > 0.895) && (idleShare < 0.90));
+
+	printf("  idle %.2f%%, %u wake-ups\n", idleShare * 100, unsigned(residency.wakeUps));
+
+	SoftTimerStop(softTimer);
+}
+
+static void CheckNearestDeadline()
+{
+	static SoftTimer 	fast, slow, oneShot;
+	static TimerRecord 	fastRecord, slowRecord, oneShotRecord;
+
+	printf("Three timers, 7ms and 25ms periods, 18ms one-shot:\n");
+
+	Arm(fast, 		fastRecord, 	7 * TICKS_PER_MS, 	7 * TICKS_PER_MS);
+	Arm(slow, 		slowRecord, 	25 * TICKS_PER_MS, 	25 * TICKS_PER_MS);
+	Arm(oneShot, 	oneShotRecord, 	18 * TICKS_PER_MS, 	0);
+
+	const uint32_t startWfi = wfiCalls;
+	RunUntil(Now() + (175 * TICKS_PER_MS));
+
+	Check("all deadlines served", (25 == fastRecord.calls) && (7 == slowRecord.calls) && (1 == oneShotRecord.calls));
+	Check("callbacks run on their deadlines", !fastRecord.b_early && !slowRecord.b_early && !oneShotRecord.b_early &&
+											  (0 == fastRecord.maxLateness) && (0 == slowRecord.maxLateness) && (0 == oneShotRecord.maxLateness));
+	Check("coinciding deadlines share a wake-up", (wfiCalls - startWfi) < (fastRecord.calls + slowRecord.calls + oneShotRecord.calls));
+
+	SoftTimerStop(fast);
+	SoftTimerStop(slow);
+}
+
+static void CheckExternalWakeUp()
+{
+	static SoftTimer 	softTimer;
+	static TimerRecord 	record;
+
+	printf("Another interrupt during the sleep:\n");
+
+	Arm(softTimer, record, 10 * TICKS_PER_MS, 10 * TICKS_PER_MS);
+	nextExternalIrq = Now() + (4 * TICKS_PER_MS);
+
+	const uint32_t startWfi = wfiCalls;
+	RunUntil(Now() + (20 * TICKS_PER_MS));
+
+	Check("woken up early once", (wfiCalls - startWfi) == (record.calls + 1));
+	Check("no callback before its deadline", (2 == record.calls) && !record.b_early && (0 == record.maxLateness));
+
+	SoftTimerStop(softTimer);
+}
+
+static void CheckShortDistance()
+{
+	static SoftTimer 	softTimer;
+	static TimerRecord 	record;
+
+	printf("Deadline closer than the minimum sleep:\n");
+
+	Arm(softTimer, record, IDLE_MIN_SLEEP_TICKS / 2, 0);
+
+	const uint32_t startWfi = wfiCalls;
+	const XTime start = Now();
+
+	// Stops once served, with no timer left the idle manager would sleep for the widest distance
+	while(SimCheckPassed() && ((Now() - start) < IDLE_MIN_SLEEP_TICKS))
+	{
+		IdleProcessTimers();
+		if(0 != record.calls)
+			break;
+
+		GlobalTimerSimAdvance(LOOP_TICKS);
+		IdleEnter();
+	}
+
+	Check("no sleep for a short distance", startWfi == wfiCalls);
+	Check("served within a loop iteration", (1 == record.calls) && (record.maxLateness < LOOP_TICKS));
+}
+
+static void CheckLongWork()
+{
+	static SoftTimer 	softTimer;
+	static TimerRecord 	record;
+
+	printf("A callback overrunning three periods:\n");
+
+	record.work 	= TICKS_PER_MS;
+	record.longWork = 35 * TICKS_PER_MS;
+	record.longCall = 2;
+	Arm(softTimer, record, 10 * TICKS_PER_MS, 10 * TICKS_PER_MS);
+
+	RunUntil(Now() + (100 * TICKS_PER_MS));
+
+	// Calls at 10, 20, 30 (35ms long), a late one at 65, then 70, 80, 90 and 100
+	Check("missed deadlines are skipped", 8 == record.calls);
+	Check("period doesn't drift after the overrun", (1 == record.lateCalls) && !record.b_early);
+
+	SoftTimerStop(softTimer);
+}
+
+static void CheckTableLimit()
+{
+	static SoftTimer extra[IDLE_MAX_SOFT_TIMERS];
+
+	printf("Timer table:\n");
+
+	// The earlier checks have registered their timers already
+	uint32_t accepted = 0;
+	for(SoftTimer& softTimer : extra)
+		accepted += SoftTimerStart(softTimer, COUNTS_PER_SECOND, 0) ? 1 : 0;
+
+	Check("a full table rejects new timers", accepted < IDLE_MAX_SOFT_TIMERS);
+	Check("a registered timer can be re-armed", SoftTimerStart(extra[0], COUNTS_PER_SECOND, 0));
+
+	for(SoftTimer& softTimer : extra)
+		SoftTimerStop(softTimer);
+}
+
+int main()
+{
+	ExceptionSimState().irqHandler = IrqDispatch;
+	GlobalTimerSimNow() = 1000;
+
+	IdleInit(&timer);
+
+	CheckPeriodic();
+	CheckNearestDeadline();
+	CheckExternalWakeUp();
+	CheckShortDistance();
+	CheckLongWork();
+	CheckTableLimit();
+
+	return SimCheckResult();
+}
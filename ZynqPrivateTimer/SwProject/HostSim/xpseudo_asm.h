@@ -0,0 +1,17 @@
+/**
+ * @file 	xpseudo_asm.h
+ * @brief	Simulated barrier and WFI instructions for building the idle manager on a host.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	WFI is provided by the simulation, it moves the time forward to the next
+ * 			interrupt and raises it.
+ */
+
+#pragma once
+
+/** Function Declarations **/
+void WfiSim();
+
+static inline void dsb() 	{}
+static inline void wfi() 	{ WfiSim(); }
@@ -0,0 +1,185 @@
+/**
+ * @brief	  	Tickless idle manager built on top of the Zynq Private Timer
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "IdleManager.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+
+/** Global Variables **/
+static XScuTimer* 	p_timer = nullptr;
+static SoftTimer* 	softTimers[IDLE_MAX_SOFT_TIMERS] = {nullptr};
+
+static XTime 			lastWakeUp	= 0;	// End of the last idle period
+static XTime 			windowStart	= 0;	// Start of the current residency window
+static IdleResidency 	window;				// Residency being accumulated
+static IdleResidency 	lastWindow;			// Residency of the last complete window
+
+void IdleInit(XScuTimer* timer)
+{
+	if(nullptr == timer)
+		while(1);
+
+	p_timer = timer;
+
+	// The timer is re-programmed for each idle period, it must not reload itself
+	XScuTimer_Stop(p_timer);
+	XScuTimer_DisableAutoReload(p_timer);
+	XScuTimer_ClearInterruptStatus(p_timer);
+	XScuTimer_EnableInterrupt(p_timer);
+
+	XTime_GetTime(&lastWakeUp);
+	windowStart = lastWakeUp;
+}
+
+void IdleTimerIrqHandler(XScuTimer* timer)
+{
+	// The interrupt only wakes the core up, expired timers are processed in thread context
+	XScuTimer_ClearInterruptStatus(timer);
+}
+
+bool SoftTimerStart(SoftTimer& softTimer, XTime delay, XTime period)
+{
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	softTimer.deadline	= now + delay;
+	softTimer.period 	= period;
+
+	// Register the timer if it wasn't registered before
+	size_t freeSlot = IDLE_MAX_SOFT_TIMERS;
+	for(size_t idx = 0; idx < IDLE_MAX_SOFT_TIMERS; ++idx)
+	{
+		if(&softTimer == softTimers[idx])
+		{
+			softTimer.b_active = true;
+
+			return true;
+		}
+
+		if((nullptr == softTimers[idx]) && (IDLE_MAX_SOFT_TIMERS == freeSlot))
+			freeSlot = idx;
+	}
+
+	// Timer table is full
+	if(IDLE_MAX_SOFT_TIMERS == freeSlot)
+		return false;
+
+	softTimers[freeSlot] = &softTimer;
+	softTimer.b_active = true;
+
+	return true;
+}
+
+void SoftTimerStop(SoftTimer& softTimer)
+{
+	softTimer.b_active = false;
+}
+
+void IdleProcessTimers()
+{
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	for(SoftTimer* softTimer : softTimers)
+	{
+		if((nullptr == softTimer) || !softTimer->b_active || (softTimer->deadline > now))
+			continue;
+
+		// Re-arm periodic timers relative to the missed deadline so that the period doesn't drift
+		if(0 != softTimer->period)
+		{
+			do{
+				softTimer->deadline += softTimer->period;
+			}while(softTimer->deadline <= now);
+		}
+		else
+			softTimer->b_active = false;
+
+		if(nullptr != softTimer->callback)
+			softTimer->callback(softTimer->arguments);
+	}
+}
+
+/**
+ * @brief	Finds the nearest deadline among the active software timers
+ * @param	now	Current value of the global timer
+ * @return	Distance to the nearest deadline in timer ticks, zero if a timer has already expired
+ */
+static XTime NextDeadline(const XTime now)
+{
+	XTime nearest = XTime(UINT32_MAX);	// Widest distance the private timer can count
+
+	for(const SoftTimer* softTimer : softTimers)
+	{
+		if((nullptr == softTimer) || !softTimer->b_active)
+			continue;
+
+		if(softTimer->deadline <= now)
+			return 0;
+
+		if((softTimer->deadline - now) < nearest)
+			nearest = softTimer->deadline - now;
+	}
+
+	return nearest;
+}
+
+void IdleEnter()
+{
+	XTime sleepStart = 0, sleepEnd = 0;
+
+	// Interrupts are masked so that no IRQ can slip in between the deadline check and WFI
+	// A pending IRQ still wakes the core up, it is served right after unmasking
+	Xil_ExceptionDisableMask(XIL_EXCEPTION_IRQ);
+
+	XTime_GetTime(&sleepStart);
+
+	const XTime distance = NextDeadline(sleepStart);
+
+	if(distance >= IDLE_MIN_SLEEP_TICKS)
+	{
+		// Program the private timer as a one-shot for the nearest deadline
+		XScuTimer_Stop(p_timer);
+		XScuTimer_ClearInterruptStatus(p_timer);
+		XScuTimer_LoadTimer(p_timer, uint32_t(distance));
+		XScuTimer_Start(p_timer);
+
+		dsb();
+		wfi();
+
+		XScuTimer_Stop(p_timer);
+		XTime_GetTime(&sleepEnd);
+
+		window.activeTicks 	+= sleepStart - lastWakeUp;
+		window.idleTicks 	+= sleepEnd - sleepStart;
+		window.wakeUps 		+= 1;
+	}
+	else
+	{
+		// Not worth sleeping, count the time as active
+		sleepEnd = sleepStart;
+		window.activeTicks += sleepStart - lastWakeUp;
+	}
+
+	lastWakeUp = sleepEnd;
+
+	// Close the residency window every second
+	if((sleepEnd - windowStart) >= IDLE_TICKS_PER_SECOND)
+	{
+		lastWindow 	= window;
+		window 		= IdleResidency();
+		windowStart = sleepEnd;
+	}
+
+	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+}
+
+IdleResidency IdleGetResidency()
+{
+	// Windows are closed in thread context only, no locking needed
+	return lastWindow;
+}
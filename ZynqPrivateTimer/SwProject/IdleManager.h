@@ -0,0 +1,53 @@
+/**
+ * @brief	  	Tickless idle manager built on top of the Zynq Private Timer
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ *
+ * @note		Software timers are kept in a small table. Whenever the application has
+ * 				nothing to do, IdleEnter() finds the nearest deadline, programs the private
+ * 				timer as a one-shot for exactly that distance and puts the core into WFI.
+ * 				The global timer is used as the free running time base, both timers are
+ * 				clocked at the same frequency (half the CPU clock).
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xscutimer.h"
+#include "xtime_l.h"
+
+/** Definitions **/
+#define IDLE_MAX_SOFT_TIMERS	8
+
+// The private timer is clocked half the CPU frequency, same as the global timer
+#define IDLE_TICKS_PER_SECOND	(XTime(COUNTS_PER_SECOND))
+#define IDLE_TICKS_PER_MS		(IDLE_TICKS_PER_SECOND / 1000)
+
+// Sleeping for shorter durations costs more than it saves
+#define IDLE_MIN_SLEEP_TICKS	(IDLE_TICKS_PER_MS / 100)
+
+/** Custom Structures **/
+typedef void (*SoftTimerCallback)(void* arguments);
+
+struct SoftTimer{
+	XTime 				deadline	= 0;		// Absolute global timer value of the next expiry
+	XTime 				period		= 0;		// Zero for one-shot timers
+	SoftTimerCallback 	callback	= nullptr;
+	void* 				arguments	= nullptr;
+	volatile bool 		b_active	= false;
+};
+
+struct IdleResidency{
+	XTime 		activeTicks	= 0;	// Time spent outside of WFI
+	XTime 		idleTicks	= 0;	// Time spent inside of WFI
+	uint32_t 	wakeUps		= 0;	// Number of WFI exits
+};
+
+/** Function Declarations **/
+void IdleInit(XScuTimer* timer);										// Must be called after the timer driver is initialized
+void IdleTimerIrqHandler(XScuTimer* timer);								// Must be connected to the private timer interrupt
+bool SoftTimerStart(SoftTimer& softTimer, XTime delay, XTime period);	// Registers and arms a software timer
+void SoftTimerStop(SoftTimer& softTimer);								// Disarms a software timer
+void IdleProcessTimers();												// Runs the callbacks of expired timers (thread context)
+void IdleEnter();														// Sleeps until the nearest deadline or any other IRQ
+IdleResidency IdleGetResidency();										// Residency statistics of the last complete second
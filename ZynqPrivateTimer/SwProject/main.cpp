@@ -2,12 +2,16 @@
  * @brief	  	Main software file for using Zynq Private Timer
  * @author		Caglayan DOKME, caglayandokme@gmail.com
  * @date	  	September 26, 2021 -> Created
+ * 				October 19, 2026 -> Tickless idle added.
+ * 				October 19, 2026 -> GIC vector table added.
  */
 
  /** Libraries **/
 #include "xparameters.h"
 #include "xscutimer.h"
 #include "xscugic.h"
+#include "GicVectorTable.h"
+#include "IdleManager.h"
 #include <stdio.h>
 
 /** Definitions **/
@@ -22,59 +26,42 @@ XScuTimer timer;
 XScuGic gic;
 
 /** Global Variables **/
-volatile bool b_timerExpired = false;
+SoftTimer periodicTimer;
 
-void StartTimer()
+void PeriodicTimerCallback(void* arguments)
 {
-	// Load the value to start down counting
-	XScuTimer_LoadTimer(&timer, TIMER_1S_VALUE);
+	printf("Timer expired!\n");
 
-	// Trigger the start
-	XScuTimer_Start(&timer);
-}
-
-void TimerIrqHandler(void* arguments)
-{
-	// Raise the flag
-	b_timerExpired = true;
+	// Report how the last second has been spent
+	const IdleResidency residency = IdleGetResidency();
+	const XTime total = residency.activeTicks + residency.idleTicks;
 
-	// Restart the timer
-	StartTimer();
+	if(0 != total)
+	{
+		printf("Idle: %u%% (%u wake-ups)\n",
+				unsigned((residency.idleTicks * 100) / total),
+				unsigned(residency.wakeUps));
+	}
 }
 
+// Interrupt vector table
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(XPAR_PS7_SCUTIMER_0_INTR, IdleTimerIrqHandler, &timer)
+};
+
 void InitGic()
 {
 	uint32_t errCode = 0;
 
-	// Find the related configuration
-	XScuGic_Config* config = XScuGic_LookupConfig(XPAR_PS7_SCUGIC_0_DEVICE_ID);
-
-	// Check if the configuration is found
-	if(nullptr == config)
-		while(1);
-
-	// Initialize the driver using the given configuration
-	errCode = XScuGic_CfgInitialize(&gic, config, config->CpuBaseAddress);
+	errCode = GicInit(&gic);
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	errCode = XScuGic_SelfTest(&gic);
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	Xil_ExceptionInit();
-
-	// Connect the IRQ controller handler to the hardware interrupt handling logic
-	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XScuGic_InterruptHandler), &gic);
-
-	// Connect the Timer IRQ handler to the timer interrupt
-	XScuGic_Connect(&gic, XPAR_PS7_SCUTIMER_0_INTR, Xil_ExceptionHandler(TimerIrqHandler), &timer);
-
-	// Enable the interrupt from private timer device
-	XScuGic_Enable(&gic, XPAR_PS7_SCUTIMER_0_INTR);
-
-	// Enable interrupts on the processor
-	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+	GicStart();
 }
 
 void InitTimer()
@@ -98,8 +85,8 @@ void InitTimer()
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	// Enable IRQ generation
-	XScuTimer_EnableInterrupt(&timer);
+	// The idle manager owns the timer from now on (one-shot mode, IRQ enabled)
+	IdleInit(&timer);
 }
 
 int main()
@@ -108,15 +95,18 @@ int main()
 	InitTimer();
 	InitGic();
 
-	StartTimer();
+	// Periodic software timer, the private timer is only armed while idling
+	periodicTimer.callback = PeriodicTimerCallback;
+	if(!SoftTimerStart(periodicTimer, TIMER_1S_VALUE, TIMER_1S_VALUE))
+		while(1);
 
 	// Application loop
 	while(1)
 	{
-		// Wait for the timer IRQ
-		while(!b_timerExpired);
-		b_timerExpired = false;
+		// Serve the expired timers
+		IdleProcessTimers();
 
-		printf("Timer expired!\n");
+		// Sleep until the next deadline instead of spinning
+		IdleEnter();
 	}
 }
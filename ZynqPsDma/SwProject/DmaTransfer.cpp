@@ -0,0 +1,95 @@
+/**
+ * @brief	  	Verified memory to memory transfer loop of the PS DMA example
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Commands taken from a pool in the fast arena.
+ */
+
+/** Libraries **/
+#include "DmaTransfer.h"
+#include "HotSection.h"
+#include <string.h>
+
+/** Definitions **/
+#define DMA_CHANNEL 	0
+
+/** IRQ Flags **/
+HOT_DATA volatile bool b_dmaDone = false;
+
+/** Global Variables **/
+static Pool<XDmaPs_Cmd, XDMAPS_CHANNELS_PER_DEV> commands;
+static XDmaPs_Cmd* p_inFlight = nullptr;	// Command of the transfer on the channel
+
+bool DmaTransferInit(Arena& arena)
+{
+	return commands.Init("DMA cmd", arena);
+}
+
+HOT_CODE void DmaDoneHandler(unsigned int channel, XDmaPs_Cmd* command, void* arguments)
+{
+	b_dmaDone = true;
+}
+
+bool DmaStart(XDmaPs* dma, void* src, void* dest, size_t size)
+{
+	// DMA Command structure is used to configure the transaction
+	XDmaPs_Cmd* const dmaCmd = commands.New();
+	if(nullptr == dmaCmd)
+		return false;
+
+	/* !!!!!!!!!!!! ATTENTION !!!!!!!!!!!!
+	 * Somehow, the DMA command instance needs to be cleared.
+	 * New() value-initializes it, which clears it.
+	 * Otherwise, in the background, the generated DMA program
+	 * fails and the DMA engine cannot transfer data properly.
+	 * Even runtime faults can occur during the operation. */
+
+	dmaCmd->ChanCtrl.SrcBurstSize 	= 4;
+	dmaCmd->ChanCtrl.SrcBurstLen 	= 4;
+	dmaCmd->ChanCtrl.SrcInc 		= 1;
+	dmaCmd->ChanCtrl.DstBurstSize 	= 4;
+	dmaCmd->ChanCtrl.DstBurstLen	= 4;
+	dmaCmd->ChanCtrl.DstInc 		= 1;
+	dmaCmd->BD.SrcAddr 	= UINTPTR(src);
+	dmaCmd->BD.DstAddr 	= UINTPTR(dest);
+	dmaCmd->BD.Length	= size;
+
+	p_inFlight = dmaCmd;
+
+	if(XST_SUCCESS != XDmaPs_Start(dma, DMA_CHANNEL, dmaCmd, 0))
+	{
+		p_inFlight = nullptr;
+		commands.Delete(dmaCmd);
+		return false;
+	}
+
+	return true;
+}
+
+bool DmaLoopStep(XDmaPs* dma, uint8_t* source, uint8_t* dest, size_t size)
+{
+	// Wait until the transfer is completed
+	while(!b_dmaDone);
+	b_dmaDone = false;
+
+	// The driver is done with the command
+	if(!commands.Delete(p_inFlight))
+		return false;
+
+	p_inFlight = nullptr;
+
+	// Compare the data buffers
+	if(memcmp(source, dest, size) != 0)
+		return false;
+
+	// Re-adjust the source buffer
+	for(size_t idx = 0; idx < size; ++source[idx++]);
+
+	// Restart the DMA
+	return DmaStart(dma, source, dest, size);
+}
+
+const MemoryStatistics& DmaCommandStatistics()
+{
+	return commands.Statistics();
+}
@@ -0,0 +1,37 @@
+/**
+ * @brief	  	Verified memory to memory transfer loop of the PS DMA example
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Commands taken from a pool in the fast arena.
+ *
+ * @note		A step of the loop waits for the transfer in flight, compares the destination
+ * 				with the source, modifies the source and starts the next transfer. The done
+ * 				interrupt only sets a flag, both are placed into the hot sections.
+ *
+ * 				The driver keeps a pointer to the command of a transfer and writes to it in the
+ * 				done interrupt, thus a command must outlive its transfer. The commands come from
+ * 				a pool in the fast arena (OCM), one for each channel, and the command of a
+ * 				transfer is freed once the loop has seen it done.
+ *
+ * 				DmaTransferInit() must be called once the arena is initialized, and the done
+ * 				handler must be connected to channel 0 of the controller before the first
+ * 				DmaStart() call.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xdmaps.h"
+#include "MemoryPool.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** Global Variables **/
+extern volatile bool b_dmaDone;		// Set by DmaDoneHandler()
+
+/** Function Declarations **/
+bool DmaTransferInit(Arena& arena);																// Carves the command pool, returns false if the arena is exhausted
+void DmaDoneHandler(unsigned int channel, XDmaPs_Cmd* command, void* arguments);		// Done handler of channel 0
+bool DmaStart(XDmaPs* dma, void* src, void* dest, size_t size);							// Returns false if no command is free or the driver rejects it
+bool DmaLoopStep(XDmaPs* dma, uint8_t* source, uint8_t* dest, size_t size);				// Returns false on a data mismatch or a failed restart
+const MemoryStatistics& DmaCommandStatistics();
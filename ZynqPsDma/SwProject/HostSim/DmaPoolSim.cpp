@@ -0,0 +1,130 @@
+/**
+ * @file 	DmaPoolSim.cpp
+ * @brief	Host test of the object pools and of the DMA command pool of the example.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The pool checks run on a heap block standing for the OCM. The transfer loop of the
+ * 			example runs on the simulated DMA controller of the host benchmarks, which calls
+ * 			the done handler right after the copy. Build from the ZynqPsDma folder:
+ * 			g++ -I../Common/HostSim -I../Common -ISwProject SwProject/DmaTransfer.cpp ../Common/MemoryPool.cpp SwProject/HostSim/DmaPoolSim.cpp -o dmapoolsim
+ */
+
+/** Libraries **/
+#include "xdmaps.h"
+#include "DmaTransfer.h"
+#include "MemoryPool.h"
+#include "SimCheck.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Definitions **/
+#define OCM_ARENA_SIZE 		(16 * 1024)
+#define DDR_ARENA_SIZE 		(64 * 1024)
+#define BUFFER_SIZE 		128
+#define LOOP_STEPS 			1000
+
+/** Custom Structures **/
+// Counts its destructions, a double delete must not destruct it again
+struct Tracked{
+	static uint32_t destructions;
+
+	uint32_t value;
+
+	explicit Tracked(uint32_t initial) : value(initial) {}
+	~Tracked() { ++destructions; }
+};
+
+uint32_t Tracked::destructions = 0;
+
+/** Hardware Instances **/
+static XDmaPs dma;
+
+static bool InArena(const void* object, const uint8_t* base, const size_t size)
+{
+	const uint8_t* const address = static_cast<const uint8_t*>(object);
+
+	return (address >= base) && (address < (base + size));
+}
+
+static void CheckPool()
+{
+	static Pool<Tracked, 3> pool;
+
+	printf("Object pool:\n");
+
+	Check("pool carved from the fast arena", pool.Init("Tracked", memoryFast));
+
+	Tracked* const first 	= pool.New(1);
+	Tracked* const second 	= pool.New(2);
+	Tracked* const third 	= pool.New(3);
+	Check("all slots handed out once", (nullptr != first) && (nullptr != second) && (nullptr != third) &&
+									   (first != second) && (second != third) && (first != third));
+	Check("exhausted pool returns nullptr", (nullptr == pool.New(4)) && (1 == pool.Statistics().failures));
+
+	Check("object freed", pool.Delete(second) && (1 == Tracked::destructions));
+	Check("double delete rejected", !pool.Delete(second) && (1 == Tracked::destructions));
+	Check("double free rejected", !pool.Free(second) && (2 == pool.Statistics().used));
+
+	Tracked outsider(0);
+	Check("foreign object rejected", !pool.Free(&outsider) && !pool.Free(reinterpret_cast<Tracked*>(reinterpret_cast<uint8_t*>(first) + 1)));
+
+	// The slot is linked once, thus handed out once
+	Tracked* const reused = pool.New(5);
+	Check("freed slot reused", (second == reused) && (5 == reused->value));
+	Check("slot not handed out twice", nullptr == pool.New(6));
+
+	Check("statistics", (3 == pool.Statistics().used) && (3 == pool.Statistics().highWater) && (4 == pool.Statistics().failures));
+
+	pool.Delete(first);
+	pool.Delete(third);
+	pool.Delete(reused);
+	Check("all slots returned", 0 == pool.Statistics().used);
+}
+
+static void CheckDmaCommands(const uint8_t* ocm)
+{
+	printf("DMA commands:\n");
+
+	uint8_t* const source 	= memoryBulk.Allocate<uint8_t>(BUFFER_SIZE);
+	uint8_t* const dest 	= memoryFast.Allocate<uint8_t>(BUFFER_SIZE);
+
+	for(size_t idx = 0; idx < BUFFER_SIZE; ++idx)
+		source[idx] = uint8_t(idx);
+
+	Check("command pool carved from the fast arena", DmaTransferInit(memoryFast));
+
+	// Records the command given to the driver
+	static XDmaPs_Cmd* p_seen = nullptr;
+	Check("done handler connected", XST_SUCCESS == XDmaPs_SetDoneHandler(&dma, 0, [](unsigned int channel, XDmaPs_Cmd* command, void* arguments) {
+		p_seen = command;
+		DmaDoneHandler(channel, command, arguments);
+	}, nullptr));
+
+	Check("first transfer started", DmaStart(&dma, source, dest, BUFFER_SIZE));
+	Check("command lives in the OCM", InArena(p_seen, ocm, OCM_ARENA_SIZE));
+
+	bool b_stepsPassed = true;
+	for(uint32_t step = 0; step < LOOP_STEPS; ++step)
+		b_stepsPassed &= DmaLoopStep(&dma, source, dest, BUFFER_SIZE);
+
+	const MemoryStatistics& statistics = DmaCommandStatistics();
+	Check("transfers verified", b_stepsPassed && ((LOOP_STEPS + 1) == dma.transfers));
+	Check("a single command in use at a time", (1 == statistics.used) && (1 == statistics.highWater));
+	Check("no command lost", 0 == statistics.failures);
+}
+
+int main()
+{
+	uint8_t* const ocm = static_cast<uint8_t*>(malloc(OCM_ARENA_SIZE));
+
+	memoryFast.Init("OCM", ocm, OCM_ARENA_SIZE);
+	memoryBulk.Init("DDR", malloc(DDR_ARENA_SIZE), DDR_ARENA_SIZE);
+
+	CheckPool();
+	CheckDmaCommands(ocm);
+
+	MemoryPrintReport();
+
+	return SimCheckResult();
+}
@@ -2,6 +2,12 @@
  * @brief	  	Main software file for using Zynq PS DMA
  * @author		Caglayan DOKME, caglayandokme@gmail.com
  * @date	  	October 6, 2021 -> Created
+ * 				October 19, 2026 -> Trace level filtering added.
+ * 				October 19, 2026 -> GIC vector table added.
+ * 				October 19, 2026 -> Buffers moved to the memory arenas.
+ * 				October 19, 2026 -> Done handler placed into the OCM.
+ * 				October 19, 2026 -> Transfer loop moved into DmaTransfer.
+ * 				October 19, 2026 -> DMA commands taken from a pool in the OCM.
  */
 
 /** Libraries **/
@@ -9,62 +15,113 @@
 #include "xdmaps.h"
 #include "xscugic.h"
 #include "xil_cache.h"
+#include "GicVectorTable.h"
+#include "MemoryPool.h"
+#include "HotSection.h"
+#include "Trace.h"
+#include "DmaTransfer.h"
+
+/** Definitions **/
+// Compile time trace level of the module, override with -DTRACE_LEVEL_DMA=...
+#ifndef TRACE_LEVEL_DMA
+#define TRACE_LEVEL_DMA		TRACE_LEVEL_INFO
+#endif
+
+TRACE_MODULE(TraceDma, TRACE_LEVEL_DMA)
+
+#define BUFFER_SIZE 		128
+
+// High OCM, only the hot sections are placed there by the linker script
+#define OCM_ARENA_START 	0xFFFF0000
+#define OCM_ARENA_END 		0xFFFFF800	// The top is left free, the boot ROM parks the second core at 0xFFFFFE00
+
+/** Linker Script Symbols **/
+extern "C" uint8_t _end;	// End of the application in DDR
 
 /** Hardware Instances **/
 XDmaPs 	dma;
 XScuGic gic;
 
 /** Global Variables **/
-uint8_t sourceBuffer[128] 	= {0};
-uint8_t destBuffer[128] 	= {0};
+uint8_t* sourceBuffer 		= nullptr;	// DDR
+uint8_t* destBuffer 		= nullptr;	// OCM
+uint32_t transferCount 		= 0;
 
-/** IRQ Flags **/
-volatile bool b_dmaDone = false;
+/** Interrupt Vector Table **/
+// The DMA driver ISRs call the user handlers set by InitDma()
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(XPAR_XDMAPS_0_FAULT_INTR, 	XDmaPs_FaultISR, 	&dma),
+	GIC_BIND(XPAR_XDMAPS_0_DONE_INTR_0, XDmaPs_DoneISR_0, 	&dma)
+};
 
 /** Function Declarations **/
+void InitMemory();	// Arenas and buffers
 void InitDma();		// DMA Initialization
 void InitGic();		// GIC Initialization
-void DmaDoneHandler(void* arguments);				// DMA Done IRQ Handler
 void DmaFaultHandler(void* arguments);				// DMA Fault IRQ Handler
-void StartDma(void* src, void* dest, size_t size);	// Function to start the DMA
 
 int main()
 {
 	// Disable the cache to prevent coherency issues
 	Xil_DCacheDisable();
 
+	InitMemory();
+
 	// Prepare incremental data
-	for(uint8_t idx = 0; idx < sizeof(sourceBuffer); sourceBuffer[idx] = idx++);
+	for(uint8_t idx = 0; idx < BUFFER_SIZE; sourceBuffer[idx] = idx++);
 
 	// Initialization
 	InitGic();
 	InitDma();
 
+	TRACE(TraceDma, TRACE_LEVEL_INFO, "DMA example started\n");
+
+	MemoryPrintReport();
+
+	const HotSymbol hotSymbols[] = {HOT_SYMBOL(DmaDoneHandler), HOT_SYMBOL(b_dmaDone)};
+	HotPrintReport(hotSymbols, sizeof(hotSymbols) / sizeof(hotSymbols[0]));
+
 	// Start
-	StartDma(sourceBuffer, destBuffer, sizeof(sourceBuffer));
+	if(!DmaStart(&dma, sourceBuffer, destBuffer, BUFFER_SIZE))
+		while(1);
 
 	// Application loop
 	while(1)
 	{
-		// Wait until the transfer is completed
-		while(!b_dmaDone);
-		b_dmaDone = false;
-
-		// Compare the data buffers
-		if(memcmp(sourceBuffer, destBuffer, sizeof(sourceBuffer)) != 0)
+		// Wait, verify, update the source and restart
+		if(!DmaLoopStep(&dma, sourceBuffer, destBuffer, BUFFER_SIZE))
+		{
+			TRACE(TraceDma, TRACE_LEVEL_ERROR, "Transfer %u failed!\n", unsigned(transferCount));
 			while(1);
+		}
 
-		// Re-adjust the source buffer
-		for(uint8_t idx = 0; idx < sizeof(sourceBuffer); ++sourceBuffer[idx++]);
+		++transferCount;
 
-		// Restart the DMA
-		StartDma(sourceBuffer, destBuffer, sizeof(sourceBuffer));
+		// Too frequent for a release build, compiled out unless the level is raised
+		TRACE(TraceDma, TRACE_LEVEL_VERBOSE, "Transfer %u completed\n", unsigned(transferCount));
 	}
 }
 
-void DmaDoneHandler(void* arguments)
+void InitMemory()
 {
-	b_dmaDone = true;
+	// The arena starts after the hot sections if they are placed into the OCM
+	uint8_t* const ocmStart = (nullptr == HotSectionEnd()) ? reinterpret_cast<uint8_t*>(OCM_ARENA_START) : static_cast<uint8_t*>(HotSectionEnd());
+
+	memoryFast.Init("OCM", ocmStart, size_t(OCM_ARENA_END - reinterpret_cast<uintptr_t>(ocmStart)));
+	memoryBulk.Init("DDR", &_end, size_t((XPAR_PS7_DDR_0_S_AXI_HIGHADDR + 1) - reinterpret_cast<uintptr_t>(&_end)));
+
+	// The DMA moves the data from the DDR into the on-chip memory
+	sourceBuffer 	= memoryBulk.Allocate<uint8_t>(BUFFER_SIZE);
+	destBuffer 		= memoryFast.Allocate<uint8_t>(BUFFER_SIZE);
+
+	if((nullptr == sourceBuffer) || (nullptr == destBuffer))
+		while(1);
+
+	// The driver reads and updates the commands in the done interrupt
+	if(!DmaTransferInit(memoryFast))
+		while(1);
+
+	memset(destBuffer, 0, BUFFER_SIZE);
 }
 
 void DmaFaultHandler(void* arguments)
@@ -94,7 +151,7 @@ void InitDma()
 		while(1);
 
 	// Connect user IRQ handler to the BSP's IRQ handler
-	errCode = XDmaPs_SetDoneHandler(&dma, 0, XDmaPsDoneHandler(DmaDoneHandler), nullptr);
+	errCode = XDmaPs_SetDoneHandler(&dma, 0, DmaDoneHandler, nullptr);
 	if(XST_SUCCESS != errCode)
 		while(1);
 
@@ -104,74 +161,18 @@ void InitDma()
 		while(1);
 }
 
-void StartDma(void* src, void* dest, size_t size)
-{
-	uint32_t errCode = 0;
-
-	// DMA Command structure is used to configure the transaction
-	XDmaPs_Cmd dmaCmd{};
-
-	/* !!!!!!!!!!!! ATTENTION !!!!!!!!!!!!
-	 * Somehow, the DMA command instance needs to be cleared.
-	 * You can either do it during construction or explicitly
-	 * using a memset(..) call.
-	 * Otherwise, in the background, the generated DMA program
-	 * fails and the DMA engine cannot transfer data properly.
-	 * Even runtime faults can occur during the operation. */
-	// memset(&dmaCmd, 0, sizeof(XDmaPs_Cmd));
-
-	dmaCmd.ChanCtrl.SrcBurstSize 	= 4;
-	dmaCmd.ChanCtrl.SrcBurstLen 	= 4;
-	dmaCmd.ChanCtrl.SrcInc 			= 1;
-	dmaCmd.ChanCtrl.DstBurstSize 	= 4;
-	dmaCmd.ChanCtrl.DstBurstLen	 	= 4;
-	dmaCmd.ChanCtrl.DstInc 			= 1;
-	dmaCmd.BD.SrcAddr 	= (uint32_t) src;
-	dmaCmd.BD.DstAddr 	= (uint32_t) dest;
-	dmaCmd.BD.Length	= size;
-
-	errCode = XDmaPs_Start(&dma, 0, &dmaCmd, 0);
-	if(XST_SUCCESS != errCode)
-		while(1);
-}
-
 void InitGic()
 {
 	uint32_t errCode = 0;
 
-	// Find the related configuration
-	XScuGic_Config* config = XScuGic_LookupConfig(XPAR_PS7_SCUGIC_0_DEVICE_ID);
-
-	// Check if the configuration is found
-	if(nullptr == config)
-		while(1);
-
-	// Initialize the driver using the given configuration
-	errCode = XScuGic_CfgInitialize(&gic, config, config->CpuBaseAddress);
+	errCode = GicInit(&gic);
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	errCode = XScuGic_SelfTest(&gic);
+	// Only allows the interrupts, the PS DMA device must be configured to generate them
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	Xil_ExceptionInit();
-
-	// Connect the IRQ controller handler to the hardware interrupt handling logic
-	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XScuGic_InterruptHandler), &gic);
-
-	// Connect the DMA Fault Handler to the related interrupt
-	XScuGic_Connect(&gic, XPAR_XDMAPS_0_FAULT_INTR, Xil_ExceptionHandler(XDmaPs_FaultISR), &dma);
-
-	// Connect the DMA Done Handlers to the related interrupts
-	XScuGic_Connect(&gic, XPAR_XDMAPS_0_DONE_INTR_0, Xil_ExceptionHandler(XDmaPs_DoneISR_0), &dma);
-
-	// Enable the interrupts from PS DMA device
-	// This line only allows interrupts from the PS DMA device
-	// You must explicitly configure the PS DMA device to generate interrupts
-	XScuGic_Enable(&gic, XPAR_XDMAPS_0_DONE_INTR_0);
-	XScuGic_Enable(&gic, XPAR_XDMAPS_0_FAULT_INTR);
-
-	// Enable interrupts on the processor
-	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+	GicStart();
 }
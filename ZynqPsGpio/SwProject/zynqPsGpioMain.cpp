@@ -2,14 +2,19 @@
  * @brief	  	Main software file for using Zynq PS GPIO on Zedboard
  * @author		Caglayan DOKME, caglayandokme@gmail.com
  * @date	  	September 24, 2021 -> Created
+ * 				October 19, 2026 -> Deferred logging added.
+ * 				October 19, 2026 -> Trace level filtering added.
+ * 				October 19, 2026 -> GIC vector table added.
  */
 
  /** Libraries **/
 #include "xparameters.h"
 #include "xgpiops.h"
 #include "xscugic.h"
+#include "GicVectorTable.h"
 #include "sleep.h"
-#include <stdio.h>
+#include "DeferredLog.h"
+#include "Trace.h"
 
 /** Definitions **/
 #define PIN_JE1		13
@@ -30,6 +35,20 @@
 #define	HIGH 		1
 #define	LOW 		0
 
+// Deferred log formats, decode with Common/DeferredLogDecoder.py
+#define LOG_FORMATS(FORMAT)																\
+	FORMAT(LOG_INPUTS, "JE7 is %u, JE8 is %u, JE9 is %u, JE10 is %u\r\n")				\
+	FORMAT(LOG_JE7_RISING_EDGE, "JE7 Rising Edge IRQ occurred!\r\n")
+
+DLOG_DEFINE_FORMATS(LOG_FORMATS)
+
+// Compile time trace level of the module, override with -DTRACE_LEVEL_GPIO=...
+#ifndef TRACE_LEVEL_GPIO
+#define TRACE_LEVEL_GPIO	TRACE_LEVEL_INFO
+#endif
+
+TRACE_MODULE(TraceGpio, TRACE_LEVEL_GPIO)
+
 /** Hardware Instances **/
 XGpioPs gpio;
 XScuGic gic;
@@ -37,44 +56,29 @@ XScuGic gic;
 /** Global Variables **/
 volatile bool b_gpioIrqFlag = false;
 
-void GpioIrqHandler(void* arguments)
+void GpioIrqHandler(void* arguments, u32 bank, u32 status)
 {
 	b_gpioIrqFlag = true;
 }
 
+// Interrupt vector table
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(XPS_GPIO_INT_ID, XGpioPs_IntrHandler, &gpio)	// PS GPIO driver calls GpioIrqHandler
+};
+
 void InitGic()
 {
 	uint32_t errCode = 0;
 
-	// Find the related configuration
-	XScuGic_Config* config = XScuGic_LookupConfig(XPAR_PS7_SCUGIC_0_DEVICE_ID);
-
-	// Check if the configuration is found
-	if(nullptr == config)
-		while(1);
-
-	// Initialize the driver using the given configuration
-	errCode = XScuGic_CfgInitialize(&gic, config, config->CpuBaseAddress);
+	errCode = GicInit(&gic);
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	errCode = XScuGic_SelfTest(&gic);
+	errCode = GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0]));
 	if(XST_SUCCESS != errCode)
 		while(1);
 
-	Xil_ExceptionInit();
-
-	// Connect the IRQ controller handler to the hardware interrupt handling logic
-	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XScuGic_InterruptHandler), &gic);
-
-	// Connect the PS GPIO device driver handler to the PS GPIO interrupt
-	XScuGic_Connect(&gic, XPS_GPIO_INT_ID, Xil_ExceptionHandler(XGpioPs_IntrHandler), &gpio);
-
-	// Enable the interrupt from PS GPIO device
-	XScuGic_Enable(&gic, XPS_GPIO_INT_ID);
-
-	// Enable interrupts on the processor
-	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+	GicStart();
 }
 
 void InitGpio()
@@ -120,7 +124,7 @@ void InitGpio()
 	XGpioPs_SetIntrTypePin(&gpio, PIN_JE7, XGPIOPS_IRQ_TYPE_EDGE_RISING);
 
 	// Declare a callback function for the PS GPIO interrupt
-	XGpioPs_SetCallbackHandler(&gpio, &gpio, (XGpioPs_Handler)GpioIrqHandler);
+	XGpioPs_SetCallbackHandler(&gpio, &gpio, GpioIrqHandler);
 
 	// Enable the interrupt generation of PS GPIO
 	XGpioPs_IntrEnablePin(&gpio, PIN_JE7);
@@ -159,41 +163,20 @@ void UpdateOutput(const uint8_t value)
 
 void LogInput()
 {
-	// Read each pin and log their values
-	if(XGpioPs_ReadPin(&gpio, PIN_JE7))
-		printf("JE7 is HIGH");
-	else
-		printf("JE7 is LOW");
-
-	printf("\r\n");
-
-	if(XGpioPs_ReadPin(&gpio, PIN_JE8))
-		printf("JE8 is HIGH");
-	else
-		printf("JE8 is LOW");
-
-	printf("\r\n");
-
-	if(XGpioPs_ReadPin(&gpio, PIN_JE9))
-		printf("JE9 is HIGH");
-	else
-		printf("JE9 is LOW");
-
-	printf("\r\n");
-
-	if(XGpioPs_ReadPin(&gpio, PIN_JE10))
-		printf("JE10 is HIGH");
-	else
-		printf("JE10 is LOW");
+	// Read each pin and log their values in a single record
+	// The pins are not even read if the trace is compiled out
+	TRACE_DEFERRED(TraceGpio, TRACE_LEVEL_INFO, LOG_INPUTS,
+				   XGpioPs_ReadPin(&gpio, PIN_JE7),
+				   XGpioPs_ReadPin(&gpio, PIN_JE8),
+				   XGpioPs_ReadPin(&gpio, PIN_JE9),
+				   XGpioPs_ReadPin(&gpio, PIN_JE10));
 
 	if(b_gpioIrqFlag)
 	{
 		b_gpioIrqFlag = false;
 
-		printf("JE7 Rising Edge IRQ occurred!");
+		TRACE_DEFERRED(TraceGpio, TRACE_LEVEL_INFO, LOG_JE7_RISING_EDGE);
 	}
-
-	printf("\r\n\r\n");
 }
 
 int main()
@@ -210,6 +193,11 @@ int main()
 		{
 			usleep(250 * 1000);	// 250ms
 			UpdateOutput(i);
+
+			TRACE(TraceGpio, TRACE_LEVEL_DEBUG, "Output %u activated\r\n", unsigned(i));
+
+			// Stream out the records of the previous iteration in the meantime
+			DeferredLogFlush();
 		}
 
 		// LOG the input pins over terminal
@@ -0,0 +1,222 @@
+/**
+ * @brief	  	Interrupt latency and jitter benchmark of the hot code placement
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Placement of the dispatch path reported.
+ * 				October 19, 2026 -> Timer halted while the caches are flushed.
+ */
+
+/** Libraries **/
+#include "IsrLatency.h"
+#include "GicVectorTable.h"
+#include "HotSection.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#include <stdio.h>
+
+/** Definitions **/
+#define SAMPLE_TIMEOUT 		(XTime(COUNTS_PER_SECOND) / 10)		// A missing interrupt stops the benchmark
+
+/** Custom Structures **/
+struct LatencyStats{
+	uint32_t samples;
+	uint32_t entryMin, entryMax, entrySum;		// Counter ticks
+	uint32_t serviceMin, serviceMax, serviceSum;
+};
+
+/** Hardware Instances **/
+static XTtcPs latencyTimer;
+
+/** Global Variables **/
+// Each handler updates the statistics placed along with it
+HOT_DATA static volatile LatencyStats 	hotStats;
+static volatile LatencyStats 			coldStats;
+
+static bool b_initialized = false;
+
+/** Interrupt Handlers **/
+static inline __attribute__((always_inline)) void Measure(XTtcPs* timer, volatile LatencyStats& stats)
+{
+	// Counting up from zero since the interval event
+	const uint32_t entry = XTtcPs_GetCounterValue(timer);
+
+	XTtcPs_ClearInterruptStatus(timer, XTTCPS_IXR_INTERVAL_MASK);
+
+	if(entry < stats.entryMin)
+		stats.entryMin = entry;
+
+	if(entry > stats.entryMax)
+		stats.entryMax = entry;
+
+	stats.entrySum += entry;
+
+	const uint32_t service = XTtcPs_GetCounterValue(timer) - entry;
+
+	if(service < stats.serviceMin)
+		stats.serviceMin = service;
+
+	if(service > stats.serviceMax)
+		stats.serviceMax = service;
+
+	stats.serviceSum += service;
+	++stats.samples;
+}
+
+HOT_CODE static void LatencyIrqHandlerHot(XTtcPs* timer)
+{
+	Measure(timer, hotStats);
+}
+
+static void LatencyIrqHandlerCold(XTtcPs* timer)
+{
+	Measure(timer, coldStats);
+}
+
+/** Interrupt Vector Table **/
+// Only one of them is connected at a time
+constexpr GicBinding hotBinding 	= GIC_BIND(XPS_TTC0_2_INT_ID, LatencyIrqHandlerHot, 	&latencyTimer);
+constexpr GicBinding coldBinding 	= GIC_BIND(XPS_TTC0_2_INT_ID, LatencyIrqHandlerCold, 	&latencyTimer);
+
+static bool InitTimer()
+{
+	XTtcPs_Config* config = XTtcPs_LookupConfig(XPAR_PS7_TTC_2_DEVICE_ID);
+	if(nullptr == config)
+		return false;
+
+	if(XST_SUCCESS != XTtcPs_CfgInitialize(&latencyTimer, config, config->BaseAddress))
+		return false;
+
+	if(XST_SUCCESS != XTtcPs_SetOptions(&latencyTimer, XTTCPS_OPTION_INTERVAL_MODE | XTTCPS_OPTION_WAVE_DISABLE))
+		return false;
+
+	// Full resolution, a tick is about 9ns
+	XTtcPs_SetInterval(&latencyTimer, ISR_LATENCY_INTERVAL);
+	XTtcPs_SetPrescaler(&latencyTimer, XTTCPS_CLK_CNTRL_PS_DISABLE);
+
+	XTtcPs_DisableInterrupts(&latencyTimer, XTTCPS_IXR_ALL_MASK);
+	XTtcPs_EnableInterrupts(&latencyTimer, XTTCPS_IXR_INTERVAL_MASK);
+
+	return true;
+}
+
+static void ResetStats(volatile LatencyStats& stats)
+{
+	stats.samples 		= 0;
+	stats.entryMin 		= UINT32_MAX;
+	stats.entryMax 		= 0;
+	stats.entrySum 		= 0;
+	stats.serviceMin 	= UINT32_MAX;
+	stats.serviceMax 	= 0;
+	stats.serviceSum 	= 0;
+}
+
+static uint32_t TicksToNs(const uint32_t ticks)
+{
+	return uint32_t((uint64_t(ticks) * 1000000000ull) / latencyTimer.Config.InputClockHz);
+}
+
+bool IsrLatencyMeasure(bool b_hot, bool b_coldCaches, IsrLatencyResult& result)
+{
+	if(!b_initialized)
+	{
+		if(!InitTimer())
+			return false;
+
+		b_initialized = true;
+	}
+
+	volatile LatencyStats& stats = b_hot ? hotStats : coldStats;
+	ResetStats(stats);
+
+	if(XST_SUCCESS != GicAttach(b_hot ? &hotBinding : &coldBinding, 1))
+		return false;
+
+	if(b_coldCaches)
+	{
+		Xil_DCacheFlush();
+		Xil_ICacheInvalidate();
+	}
+
+	XTtcPs_ResetCounterValue(&latencyTimer);
+	XTtcPs_Start(&latencyTimer);
+
+	uint32_t seen = 0;
+	XTime lastSample = 0;
+	XTime_GetTime(&lastSample);
+
+	while(stats.samples < ISR_LATENCY_SAMPLES)
+	{
+		XTime now = 0;
+		XTime_GetTime(&now);
+
+		if(seen != stats.samples)
+		{
+			seen 		= stats.samples;
+			lastSample 	= now;
+
+			// Nothing of the handler stays in the caches until the next interrupt. The flush masks
+			// the interrupts, the timer is halted meanwhile so that no event waits behind it.
+			if(b_coldCaches)
+			{
+				XTtcPs_Stop(&latencyTimer);
+
+				Xil_DCacheFlush();
+				Xil_ICacheInvalidate();
+
+				XTtcPs_ResetCounterValue(&latencyTimer);
+				XTtcPs_Start(&latencyTimer);
+			}
+		}
+		else if((now - lastSample) > SAMPLE_TIMEOUT)
+		{
+			break;
+		}
+	}
+
+	XTtcPs_Stop(&latencyTimer);
+
+	if(0 == stats.samples)
+		return false;
+
+	result.samples 		= stats.samples;
+	result.entryMinNs 	= TicksToNs(stats.entryMin);
+	result.entryAvgNs 	= TicksToNs(stats.entrySum / stats.samples);
+	result.entryMaxNs 	= TicksToNs(stats.entryMax);
+	result.serviceMinNs = TicksToNs(stats.serviceMin);
+	result.serviceAvgNs = TicksToNs(stats.serviceSum / stats.samples);
+	result.serviceMaxNs = TicksToNs(stats.serviceMax);
+
+	return ISR_LATENCY_SAMPLES == stats.samples;
+}
+
+bool IsrLatencyRun()
+{
+	bool b_success = true;
+
+	// Same for both handlers, see IsrLatency.h
+	const bool b_hotDispatch = HotIsPlaced(reinterpret_cast<const void*>(&XScuGic_InterruptHandler)) &&
+							   HotIsPlaced(reinterpret_cast<const void*>(hotBinding.trampoline));
+
+	printf("ISR latency, %u samples each, values in ns, dispatch path in %s:\n", unsigned(ISR_LATENCY_SAMPLES), b_hotDispatch ? "OCM" : "DDR");
+	printf("  handler     caches  entry min    avg    max jitter  service min    avg    max\n");
+
+	for(uint8_t idx = 0; idx < 4; ++idx)
+	{
+		const bool b_hot 		= (0 != (idx & 0x2));
+		const bool b_coldCaches = (0 != (idx & 0x1));
+		IsrLatencyResult result;
+
+		const bool b_ok = IsrLatencyMeasure(b_hot, b_coldCaches, result);
+		b_success &= b_ok;
+
+		printf("  %-11s %-6s      %6u %6u %6u %6u      %6u %6u %6u%s\n",
+				b_hot ? (HotIsPlaced(reinterpret_cast<const void*>(&LatencyIrqHandlerHot)) ? "OCM" : "OCM (n/a)") : "DDR",
+				b_coldCaches ? "cold" : "warm",
+				unsigned(result.entryMinNs), unsigned(result.entryAvgNs), unsigned(result.entryMaxNs),
+				unsigned(result.entryMaxNs - result.entryMinNs),
+				unsigned(result.serviceMinNs), unsigned(result.serviceAvgNs), unsigned(result.serviceMaxNs),
+				b_ok ? "" : " (incomplete)");
+	}
+
+	return b_success;
+}
@@ -0,0 +1,51 @@
+/**
+ * @brief	  	Interrupt latency and jitter benchmark of the hot code placement
+ * @author		Caglayan DOKME, caglayandokme@gmail.com
+ * @date	  	October 19, 2026 -> Created
+ * 				October 19, 2026 -> Placement of the dispatch path reported.
+ * 				October 19, 2026 -> Timer halted while the caches are flushed.
+ *
+ * @note		The third timer of TTC0 runs in interval mode without a prescaler. Its counter
+ * 				restarts from zero at each interval event, thus the counter value read by the
+ * 				handler is the time passed since the interrupt was raised. The handler reads it
+ * 				once at its entry and once at its exit.
+ *
+ * 				The very same handler body is measured twice, once placed into the DDR and
+ * 				once into the OCM with HOT_CODE and HOT_DATA. Each placement is measured with
+ * 				warm caches and with caches cleaned and invalidated after every interrupt, the
+ * 				latter shows the cost of the cache misses an ISR faces in a busy system. The
+ * 				flush runs with the interrupts masked, thus the timer is halted meanwhile and
+ * 				restarted from zero afterwards, no interval event is delayed by the flush.
+ *
+ * 				Only the handler and its data move between the two cases. The dispatch path in
+ * 				front of it (vector table, IRQInterrupt, XScuGic_InterruptHandler, trampoline)
+ * 				is placed by the linker script for both, the report tells where it landed. For
+ * 				the figures of a fully DDR resident path, build once more without the
+ * 				HotSectionsOcm.ld include.
+ *
+ * 				The GIC must be initialized with GicInit() beforehand.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xttcps.h"
+
+/** Definitions **/
+#define ISR_LATENCY_SAMPLES 	1000
+#define ISR_LATENCY_INTERVAL 	0xFFFF		// Counter ticks, about 590us with the 111MHz TTC clock
+
+/** Custom Structures **/
+struct IsrLatencyResult{
+	uint32_t samples 		= 0;
+	uint32_t entryMinNs 	= 0;	// Interrupt raised -> handler entered
+	uint32_t entryAvgNs 	= 0;
+	uint32_t entryMaxNs 	= 0;
+	uint32_t serviceMinNs 	= 0;	// Handler entered -> handler about to return
+	uint32_t serviceAvgNs 	= 0;
+	uint32_t serviceMaxNs 	= 0;
+};
+
+/** Function Declarations **/
+bool IsrLatencyMeasure(bool b_hot, bool b_coldCaches, IsrLatencyResult& result);	// A single placement and cache condition
+bool IsrLatencyRun();																// All combinations, prints the report
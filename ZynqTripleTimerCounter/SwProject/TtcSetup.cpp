@@ -0,0 +1,103 @@
+/**
+ * @brief	Interval timer and PWM setup of the Zynq Triple Timer Counter.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ */
+
+/** Libraries **/
+#include "TtcSetup.h"
+
+/**
+ * @brief	Common part of both setups, the driver initialization and the timing
+ * @return	false if any of the steps fails
+ */
+static bool SetupTiming(XTtcPs* timer, const uint16_t deviceId, TmrCntrSetup& setup)
+{
+	// Find the related configuration
+	XTtcPs_Config* config = XTtcPs_LookupConfig(deviceId);
+
+	// Check if the configuration is found
+	if(nullptr == config)
+		return false;
+
+	// Initialize the driver using the given configuration
+	if(XST_SUCCESS != XTtcPs_CfgInitialize(timer, config, config->BaseAddress))
+		return false;
+
+	// Self-test initially
+	if(XST_SUCCESS != XTtcPs_SelfTest(timer))
+		return false;
+
+	// Apply selected options
+	if(XST_SUCCESS != XTtcPs_SetOptions(timer, setup.options))
+		return false;
+
+	// Let the driver calculate required interval and prescaler values using the given frequency
+	XTtcPs_CalcIntervalFromFreq(timer, setup.frequency, &setup.interval, &setup.prescaler);
+
+	// Upon a failure during calculations, the values are set to their highest possible limit
+	if((XTTCPS_MAX_INTERVAL_COUNT == setup.interval) || (0xFF == setup.prescaler))
+		return false;
+
+	// Set interval and prescaler using the given values
+	XTtcPs_SetInterval(timer, setup.interval);
+	XTtcPs_SetPrescaler(timer, setup.prescaler);
+
+	/* Details of Calculation:
+	 * The TTC device can either use the PS CLK or an external clock from PL
+	 * The input frequency can be seen from the XTtcPs_Config instance.
+	 *
+	 * Inside the device, the clock is first divided by the prescaler.
+	 * Mathematical representation is as follows where the P is the prescaler value
+	 *
+	 *		PRESCALED_CLK = CLK / (2 ^ (P + 1));
+	 *
+	 * Secondly, the scaled clock is given to the internal counter.
+	 * The internal counter counts up to(down from) the given interval value.
+	 * If enabled, an interrupt signal can be generated at each overflow(underflow) of the counter.	 */
+
+	return true;
+}
+
+bool TtcSetupInterval(XTtcPs* timer, uint16_t deviceId, TmrCntrSetup& setup)
+{
+	if(!SetupTiming(timer, deviceId, setup))
+		return false;
+
+	// Enable interrupt generation (GIC also needs to be configured)
+	XTtcPs_DisableInterrupts(timer, XTTCPS_IXR_ALL_MASK);
+	XTtcPs_EnableInterrupts(timer, XTTCPS_IXR_INTERVAL_MASK);
+
+	return true;
+}
+
+bool TtcSetupPwm(XTtcPs* timer, uint16_t deviceId, TmrPwmSetup& setup, float dutyCycle)
+{
+	if(!SetupTiming(timer, deviceId, setup))
+		return false;
+
+	// Calculate a PWM match value using the duty cycle
+	setup.CalcSetMatchValue(dutyCycle);
+	if(0 == setup.matchValue)
+		return false;
+
+	// Apply the calculated match value
+	XTtcPs_SetMatchValue(timer, 0, setup.matchValue);
+	if(XTtcPs_GetMatchValue(timer, 0) != setup.matchValue)
+		return false;
+
+	/* Details of Operation:
+	 * Each timer in each TTC device has three different match values.
+	 * Each match value can be used to generate interrupts.
+	 * In timer1 of the TTC0 device, we use the match 0 to generate a PWM signal.
+	 *
+	 * The match 0 is special as it has the ability to generate a waveform if the
+	 * XTTCPS_OPTION_WAVE_POLARITY is marked at TTC device options.
+	 * The other match values doesn't have this feature.
+	 *
+	 * Frequency represents the PWM window frequency.
+	 * Interval is the resolution of a single PWM window.
+	 * Lastly, the match value is equal to the (dutyCycle * interval) */
+
+	return true;
+}
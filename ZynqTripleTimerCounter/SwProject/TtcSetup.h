@@ -0,0 +1,40 @@
+/**
+ * @brief	Interval timer and PWM setup of the Zynq Triple Timer Counter.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The application fills the frequency and the options of a setup, the functions
+ * 			initialize and self-test the driver, calculate the interval and the prescaler,
+ * 			program them and complete the setup with the calculated values. The timer is
+ * 			left stopped, start it once the interrupt controller is ready.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xttcps.h"
+#include <stdint.h>
+
+/** Custom Structures **/
+struct TmrCntrSetup{
+	uint32_t 	frequency 	= 0;
+	uint16_t 	interval	= 0;
+	uint16_t 	options		= 0;
+	uint8_t 	prescaler	= 0;
+};
+
+struct TmrPwmSetup : TmrCntrSetup{
+	uint16_t matchValue = 0;
+
+	void CalcSetMatchValue(float dutyCycle)
+	{
+		if(0 == interval)
+			while(1);
+
+		matchValue = uint16_t(float(interval) * dutyCycle);
+	}
+};
+
+/** Function Declarations **/
+bool TtcSetupInterval(XTtcPs* timer, uint16_t deviceId, TmrCntrSetup& setup);			// Interval interrupt enabled, returns false on failure
+bool TtcSetupPwm(XTtcPs* timer, uint16_t deviceId, TmrPwmSetup& setup, float dutyCycle);	// Waveform on match 0, returns false on failure
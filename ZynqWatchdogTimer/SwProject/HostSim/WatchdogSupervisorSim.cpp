@@ -0,0 +1,370 @@
+/**
+ * @file 	WatchdogSupervisorSim.cpp
+ * @brief	Host test of the multi-task watchdog supervisor against a simulated SCU watchdog.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Capture withdrawn by a recovered service loop.
+ *
+ * @note	The supervisor is built as is. The application loop of the example is run each
+ * 			millisecond: the tasks beat at their own periods, the loop services the supervisor
+ * 			and the watchdog counts down. The pre-timeout handler is stood for by a capture once
+ * 			the watchdog counter drops below the margin. A reset reboots the application, the
+ * 			page of the high OCM holding the post-mortem record is mapped at its own address
+ * 			and survives it. Build from the ZynqWatchdogTimer folder:
+ * 			g++ -ISwProject/HostSim -I../Common/HostSim -ISwProject SwProject/WatchdogSupervisor.cpp SwProject/HostSim/WatchdogSupervisorSim.cpp -o wdtsim
+ */
+
+/** Libraries **/
+#include "xscuwdt.h"
+#include "xil_cache.h"
+#include "WatchdogSupervisor.h"
+#include "SimCheck.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/** Definitions **/
+#define TICKS_PER_MS 			(COUNTS_PER_SECOND / 1000)
+#define HARDWARE_TIMEOUT 		u32(COUNTS_PER_SECOND)		// 1s, as the example
+#define PRE_TIMEOUT_MARGIN 		u32(100 * TICKS_PER_MS)
+#define OCM_PAGE_SIZE 			4096
+#define TASK_COUNT 				3
+
+/** Custom Structures **/
+struct SimTask{
+	const char* name;
+	uint32_t 	periodMs;		// Of its heartbeats
+	uint32_t 	timeoutMs;
+	bool 		b_alive;
+	uint8_t 	id;
+};
+
+struct RunResult{
+	bool 	b_reset 		= false;
+	bool 	b_failed 		= false;	// Service reported a failure
+	XTime 	failedAt 		= 0;
+	XTime 	resetAt 		= 0;
+	bool 	b_captured 		= false;	// Pre-timeout capture taken
+};
+
+/** Hardware Instances **/
+static XScuWdt watchdog;
+
+/** Global Variables **/
+static SimTask simTasks[TASK_COUNT] = {
+	{"DMA", 	20, 	50, 	true, 	WDT_SUPERVISOR_INVALID_TASK},
+	{"ADC", 	5, 		10, 	true, 	WDT_SUPERVISOR_INVALID_TASK},
+	{"Comms", 	100, 	200, 	true, 	WDT_SUPERVISOR_INVALID_TASK}
+};
+
+static bool b_serviceAlive 	= true;
+
+static XTime Now()
+{
+	return GlobalTimerSimNow();
+}
+
+// Lower half of the global timer, as the supervisor stamps
+static uint32_t Stamp()
+{
+	return uint32_t(Now());
+}
+
+/**
+ * @brief	Maps the page of the high OCM holding the post-mortem record at its own address
+ * @return	False if the host doesn't let the page be mapped there
+ */
+static bool MapOcm()
+{
+	void* const page 	= reinterpret_cast<void*>(WDT_POSTMORTEM_ADDRESS & ~UINTPTR(OCM_PAGE_SIZE - 1));
+	void* const mapped 	= mmap(page, OCM_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if(page != mapped)
+		return false;
+
+	// Content of the OCM is random at the power-up
+	uint32_t seed = 1;
+	for(uint32_t idx = 0; idx < OCM_PAGE_SIZE; ++idx)
+	{
+		seed = (seed * 1103515245) + 12345;
+		static_cast<uint8_t*>(page)[idx] = uint8_t(seed >> 16);
+	}
+
+	return true;
+}
+
+static WdtPostMortem& OcmRecord()
+{
+	return *reinterpret_cast<WdtPostMortem*>(WDT_POSTMORTEM_ADDRESS);
+}
+
+/**
+ * @brief	Boot of the example: reset reason, watchdog stage and supervisor stage
+ * @return	True if the system had been reset by the watchdog
+ */
+static bool Boot()
+{
+	const bool b_watchdogReset = XScuWdt_IsWdtExpired(&watchdog);
+
+	// Cleared for the next boot
+	watchdog.resetStatus &= ~XSCUWDT_RST_STS_RESET_FLAG_MASK;
+
+	XScuWdt_SetWdMode(&watchdog);
+	XScuWdt_LoadWdt(&watchdog, HARDWARE_TIMEOUT);
+	XScuWdt_Start(&watchdog);
+
+	WdtSupervisorInit(&watchdog);
+
+	for(SimTask& task : simTasks)
+	{
+		task.b_alive 	= true;
+		task.id 		= WdtSupervisorRegister(task.name, WDT_SUPERVISOR_MS_TO_TICKS(task.timeoutMs));
+	}
+
+	b_serviceAlive = true;
+
+	return b_watchdogReset;
+}
+
+/**
+ * @brief	Runs the application loop each millisecond until the time is up or the system resets
+ */
+static RunResult Run(const uint32_t milliseconds)
+{
+	RunResult result;
+
+	for(uint32_t ms = 0; ms < milliseconds; ++ms)
+	{
+		// Heartbeats come from the task loops and the ISRs, the service loop is only one of them
+		for(const SimTask& task : simTasks)
+		{
+			if(task.b_alive && (0 == ((Now() / TICKS_PER_MS) % task.periodMs)))
+				WdtSupervisorHeartbeat(task.id);
+		}
+
+		if(b_serviceAlive && !WdtSupervisorService() && !result.b_failed)
+		{
+			result.b_failed = true;
+			result.failedAt = Now();
+		}
+
+		// Shadow timer of the pre-timeout, restarted along with the watchdog
+		if(!result.b_captured && (watchdog.counter <= PRE_TIMEOUT_MARGIN))
+		{
+			WdtSupervisorCapture();
+			result.b_captured = true;
+		}
+
+		if(WdtSimAdvance(&watchdog, TICKS_PER_MS))
+		{
+			result.b_reset = true;
+			result.resetAt = Now();
+			break;
+		}
+	}
+
+	return result;
+}
+
+static uint32_t ElapsedMs(const WdtPostMortem& record, const uint8_t id)
+{
+	return uint32_t(((uint64_t(record.timestamp - record.lastHeartbeats[id]) * 1000) + (COUNTS_PER_SECOND / 2)) / COUNTS_PER_SECOND);
+}
+
+// As the example prints it after the reboot
+static void PrintRecord(const WdtPostMortem& record)
+{
+	printf("  Watchdog reset #%u, task \"%s\" missed its deadline\n", unsigned(record.resetCount), record.failedTaskName);
+
+	for(uint8_t id = 0; (id < record.taskCount) && (id < WDT_SUPERVISOR_MAX_TASKS); ++id)
+	{
+		const uint32_t timeoutMs = uint32_t(((uint64_t(record.timeouts[id]) * 1000) + (COUNTS_PER_SECOND / 2)) / COUNTS_PER_SECOND);
+
+		printf("    Task %u: last heartbeat %ums ago (timeout %ums)\n", unsigned(id), unsigned(ElapsedMs(record, id)), unsigned(timeoutMs));
+	}
+}
+
+static void CheckPowerUp()
+{
+	printf("Power-up with random OCM content, all tasks healthy:\n");
+
+	// Lower half of the global timer wraps around within the run
+	GlobalTimerSimNow() = 0xFFFFFFFFULL - (2 * COUNTS_PER_SECOND);
+
+	WdtPostMortem record;
+	Check("not a watchdog reset", !Boot());
+	Check("no record in the random content", !WdtSupervisorGetPostMortem(record));
+
+	const uint32_t startRestarts = watchdog.restarts;
+	const RunResult result = Run(5000);
+
+	Check("no failure across the 32-bit wrap", !result.b_failed && !result.b_reset && !result.b_captured);
+	Check("hardware restarted by each service", 5000 == (watchdog.restarts - startRestarts));
+	Check("still no record", !WdtSupervisorGetPostMortem(record));
+}
+
+static void CheckTaskStall()
+{
+	printf("ADC stops beating, 10ms timeout:\n");
+
+	const SimTask& adc = simTasks[1];
+	// Beat of an earlier pass, the task is stopped before the next one
+	const uint32_t sinceBeat 	= uint32_t(((Now() / TICKS_PER_MS) - 1) % adc.periodMs) + 1;
+	const uint32_t lastBeat 	= Stamp() - uint32_t(sinceBeat * TICKS_PER_MS);
+
+	simTasks[1].b_alive = false;
+
+	const uint32_t startFlushes = CacheSimState().flushes;
+	const RunResult result = Run(3000);
+
+	const uint32_t detection = uint32_t(result.failedAt) - lastBeat;
+	Check("detected within the timeout plus a service", result.b_failed && (detection > WDT_SUPERVISOR_MS_TO_TICKS(adc.timeoutMs)) &&
+														 (detection <= WDT_SUPERVISOR_MS_TO_TICKS(adc.timeoutMs + 1)));
+	Check("hardware no longer restarted", watchdog.lastRestart < result.failedAt);
+	Check("reset a hardware timeout after the last restart", result.b_reset && ((result.resetAt - watchdog.lastRestart) == HARDWARE_TIMEOUT));
+	Check("record flushed before the reset", (CacheSimState().flushes > startFlushes) && (WDT_POSTMORTEM_ADDRESS == CacheSimState().lastAddress) &&
+											 (sizeof(WdtPostMortem) == CacheSimState().lastLength));
+	Check("pre-timeout capture keeps the record", result.b_captured && (adc.id == OcmRecord().failedTask));
+}
+
+static void CheckReboot()
+{
+	printf("Reboot after the ADC failure:\n");
+
+	const bool b_watchdogReset = Boot();
+
+	WdtPostMortem record;
+	const bool b_valid = WdtSupervisorGetPostMortem(record);
+
+	if(b_valid)
+		PrintRecord(record);
+
+	Check("watchdog reset reported", b_watchdogReset && !XScuWdt_IsWdtExpired(&watchdog));
+	Check("record survived the reset", b_valid && (1 == record.resetCount) && (TASK_COUNT == record.taskCount));
+	Check("failed task named", b_valid && (simTasks[1].id == record.failedTask) && (0 == strcmp("ADC", record.failedTaskName)));
+
+	bool b_timestamps = b_valid;
+	for(uint8_t id = 0; b_valid && (id < TASK_COUNT); ++id)
+	{
+		b_timestamps &= (WDT_SUPERVISOR_MS_TO_TICKS(simTasks[id].timeoutMs) == record.timeouts[id]);
+		b_timestamps &= ((id == record.failedTask) == (ElapsedMs(record, id) >= simTasks[id].timeoutMs));
+	}
+
+	Check("last heartbeats and timeouts of each task", b_timestamps);
+
+	WdtSupervisorClearPostMortem();
+	Check("reported only once", !WdtSupervisorGetPostMortem(record));
+
+	Check("healthy again after the reboot", !Run(2000).b_reset);
+
+	simTasks[0].b_alive = false;
+	Check("next failure resets again", Run(3000).b_reset && Boot());
+
+	Check("resets counted across the boots", WdtSupervisorGetPostMortem(record) && (2 == record.resetCount) &&
+											 (0 == strcmp("DMA", record.failedTaskName)));
+
+	WdtSupervisorClearPostMortem();
+}
+
+static void CheckServiceStall()
+{
+	printf("Service loop stalls, tasks beating from the ISRs:\n");
+
+	WdtPostMortem record;
+
+	// Recovers within the pre-timeout margin
+	Run(500);
+	b_serviceAlive = false;
+
+	const RunResult stalled = Run(950);
+	Check("captured without a reset", stalled.b_captured && !stalled.b_reset && WdtSupervisorGetPostMortem(record));
+
+	b_serviceAlive = true;
+	Check("withdrawn once the service recovers", !Run(10).b_reset && !WdtSupervisorGetPostMortem(record));
+
+	Run(500);
+	b_serviceAlive = false;
+
+	const XTime stall = Now();
+	RunResult result = Run(3000);
+	Check("reset a hardware timeout after the stall", result.b_reset && ((result.resetAt - stall) <= HARDWARE_TIMEOUT));
+	Check("captured at the pre-timeout", result.b_captured);
+
+	// The withdrawn capture isn't counted
+	Check("service loop recorded as the failure", Boot() && WdtSupervisorGetPostMortem(record) && (WDT_SUPERVISOR_SERVICE_TASK == record.failedTask) &&
+												  (0 == strcmp("Service loop", record.failedTaskName)) && (3 == record.resetCount));
+
+	WdtSupervisorClearPostMortem();
+
+	// Comms stops as well, it is overdue by the time of the capture
+	Run(500);
+	b_serviceAlive = false;
+	Run(100);
+	simTasks[2].b_alive = false;
+
+	Check("reset again", Run(3000).b_reset && Boot());
+	Check("overdue task blamed over the stalled loop", WdtSupervisorGetPostMortem(record) && (simTasks[2].id == record.failedTask) &&
+													   (0 == strcmp("Comms", record.failedTaskName)));
+
+	WdtSupervisorClearPostMortem();
+}
+
+static void CheckCorruption()
+{
+	printf("Corrupted record:\n");
+
+	simTasks[1].b_alive = false;
+	Run(3000);
+	Boot();
+
+	// A bit flipped in the failed task name
+	OcmRecord().failedTaskName[0] ^= 0x01;
+
+	WdtPostMortem record;
+	Check("rejected by the checksum", !WdtSupervisorGetPostMortem(record));
+
+	simTasks[1].b_alive = false;
+	Run(3000);
+	Boot();
+
+	Check("reset count starts over", WdtSupervisorGetPostMortem(record) && (1 == record.resetCount));
+
+	WdtSupervisorClearPostMortem();
+}
+
+static void CheckRegistration()
+{
+	printf("Registration limits:\n");
+
+	// Three tasks are registered by the boot
+	Boot();
+
+	uint8_t lastId = WDT_SUPERVISOR_INVALID_TASK;
+	for(uint8_t idx = TASK_COUNT; idx < WDT_SUPERVISOR_MAX_TASKS; ++idx)
+		lastId = WdtSupervisorRegister("Spare", WDT_SUPERVISOR_MS_TO_TICKS(1000));
+
+	Check("tasks up to the capacity", (WDT_SUPERVISOR_MAX_TASKS - 1) == lastId);
+	Check("one more rejected", WDT_SUPERVISOR_INVALID_TASK == WdtSupervisorRegister("Extra", WDT_SUPERVISOR_MS_TO_TICKS(1000)));
+
+	Boot();
+	Check("zero timeout rejected", WDT_SUPERVISOR_INVALID_TASK == WdtSupervisorRegister("Zero", 0));
+	Check("missing name rejected", WDT_SUPERVISOR_INVALID_TASK == WdtSupervisorRegister(nullptr, WDT_SUPERVISOR_MS_TO_TICKS(1000)));
+}
+
+int main()
+{
+	if(!MapOcm())
+	{
+		printf("High OCM can't be mapped at 0x%08X on this host!\n", unsigned(WDT_POSTMORTEM_ADDRESS));
+		return 1;
+	}
+
+	CheckPowerUp();
+	CheckTaskStall();
+	CheckReboot();
+	CheckServiceStall();
+	CheckCorruption();
+	CheckRegistration();
+
+	return SimCheckResult();
+}
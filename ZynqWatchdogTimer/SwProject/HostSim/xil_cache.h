@@ -0,0 +1,38 @@
+/**
+ * @file 	xil_cache.h
+ * @brief	Simulated cache maintenance for building the watchdog supervisor on a host.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	The host has no cache to flush. The flushed ranges are recorded instead, so that
+ * 			the simulation can check that a record reached the memory before the reset.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+
+/** Simulation State **/
+struct CacheSim{
+	UINTPTR 	lastAddress 	= 0;	// Of the last flushed range
+	u32 		lastLength 		= 0;
+	u32 		flushes 		= 0;
+};
+
+inline CacheSim& CacheSimState()
+{
+	static CacheSim state;
+
+	return state;
+}
+
+/** Driver API **/
+static inline void Xil_DCacheFlushRange(UINTPTR address, u32 length)
+{
+	CacheSim& state = CacheSimState();
+
+	state.lastAddress 	= address;
+	state.lastLength 	= length;
+	++state.flushes;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file 	xscuwdt.h
+ * @brief	Simulated SCU watchdog timer for building the watchdog supervisor on a host.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ *
+ * @note	Only the part of the XScuWdt API used by the example is provided. The counter runs
+ * 			at the rate of the global timer, the simulation moves both with WdtSimAdvance().
+ * 			In watchdog mode, reaching zero asserts the reset: the reset flag is set, the
+ * 			watchdog falls back to its reset state and the simulation is expected to reboot
+ * 			the application. The reset flag survives until it is written back.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xil_types.h"
+#include "xtime_l.h"
+
+/** Definitions **/
+#define XSCUWDT_RST_STS_RESET_FLAG_MASK 	0x00000001
+
+/** Custom Structures **/
+struct XScuWdt{
+	u32 	load;
+	u32 	counter;
+	bool 	b_watchdogMode;
+	bool 	b_started;
+	u32 	resetStatus;		// Reset status register
+	u32 	restarts;
+	XTime 	lastRestart;		// Global time of the last restart
+};
+
+/** Driver API **/
+static inline void XScuWdt_SetWdMode(XScuWdt* wdt) 	{ wdt->b_watchdogMode = true; 	}
+static inline void XScuWdt_Start(XScuWdt* wdt) 		{ wdt->b_started = true; 		}
+static inline void XScuWdt_Stop(XScuWdt* wdt) 		{ wdt->b_started = false; 		}
+
+// Writing the load register reloads the counter as well
+static inline void XScuWdt_LoadWdt(XScuWdt* wdt, u32 value)
+{
+	wdt->load 		= value;
+	wdt->counter 	= value;
+}
+
+static inline void XScuWdt_RestartWdt(XScuWdt* wdt)
+{
+	wdt->counter 		= wdt->load;
+	wdt->lastRestart 	= GlobalTimerSimNow();
+	++wdt->restarts;
+}
+
+static inline bool XScuWdt_IsWdtExpired(XScuWdt* wdt)
+{
+	return XSCUWDT_RST_STS_RESET_FLAG_MASK == (wdt->resetStatus & XSCUWDT_RST_STS_RESET_FLAG_MASK);
+}
+
+/** Simulation API **/
+/**
+ * @brief	Moves the global timer and the watchdog counter by the given ticks
+ * @return	True if the watchdog asserted the reset in the meantime
+ */
+static inline bool WdtSimAdvance(XScuWdt* wdt, const XTime ticks)
+{
+	if(wdt->b_started && wdt->b_watchdogMode && (ticks >= wdt->counter))
+	{
+		// Time stops at the reset
+		GlobalTimerSimAdvance(wdt->counter);
+
+		wdt->counter 		= 0;
+		wdt->resetStatus 	|= XSCUWDT_RST_STS_RESET_FLAG_MASK;
+		wdt->b_started 		= false;
+		wdt->b_watchdogMode = false;
+
+		return true;
+	}
+
+	if(wdt->b_started)
+		wdt->counter = (ticks < wdt->counter) ? u32(wdt->counter - ticks) : 0;
+
+	GlobalTimerSimAdvance(ticks);
+
+	return false;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file 	WatchdogPreTimeout.cpp
+ * @brief	Pre-timeout warning of the SCU watchdog with crash snapshot capture.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> GIC running priority removed from the snapshot.
+ * 			October 19, 2026 -> Snapshot withdrawn once the watchdog is restarted again.
+ */
+
+/** Libraries **/
+#include "WatchdogPreTimeout.h"
+#include "WatchdogSupervisor.h"
+#include "GicVectorTable.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#include <stddef.h>
+#include <string.h>
+
+/** Definitions **/
+#define MODE_MASK	0x1F
+#define MODE_USER	0x10
+#define MODE_SYSTEM	0x1F
+
+static_assert(sizeof(WdtCrashSnapshot) <= (WDT_POSTMORTEM_ADDRESS - WDT_SNAPSHOT_ADDRESS), "Crash snapshot overlaps the post-mortem record!");
+
+/** Global Variables **/
+static XScuTimer* 				p_timer 		= nullptr;
+static uint32_t 				preTimeoutLoad 	= 0;
+static const uint32_t* 			isrVectors 		= nullptr;
+static uint8_t 					isrVectorCount 	= 0;
+static volatile bool 			b_captured 		= false;	// Snapshot taken since the last restart
+
+static WdtCrashSnapshot* const snapshot = reinterpret_cast<WdtCrashSnapshot*>(WDT_SNAPSHOT_ADDRESS);
+
+// Top of the IRQ stack, defined by the linker script of the BSP
+extern "C" uint32_t __irq_stack;
+
+static uint32_t CalcChecksum(const WdtCrashSnapshot& record)
+{
+	const uint32_t* words = reinterpret_cast<const uint32_t*>(&record);
+	uint32_t checksum = 0;
+
+	for(size_t idx = 0; idx < (offsetof(WdtCrashSnapshot, checksum) / sizeof(uint32_t)); ++idx)
+		checksum += words[idx];
+
+	return checksum;
+}
+
+/**
+ * @brief	Captures the registers of the context interrupted by the timer IRQ
+ */
+static void CaptureRegisters()
+{
+#if defined(__arm__)
+	uint32_t spsr = 0, sp = 0, lr = 0;
+
+	// Saved CPSR of the interrupted context
+	asm volatile("mrs %0, spsr" : "=r"(spsr));
+	snapshot->cpsr = spsr;
+
+	// The BSP IRQ vector pushes {r0-r3, r12, lr} first, the return address is at the top
+	snapshot->pc = (&__irq_stack)[-1] - 4;
+
+	const uint32_t mode = spsr & MODE_MASK;
+	if((MODE_SYSTEM == mode) || (MODE_USER == mode))
+	{
+		// Banked SP and LR are only visible from the system mode, switch there for a moment
+		asm volatile(
+			"mrs r3, cpsr		\n"
+			"cps #0x1F			\n"
+			"mov %0, sp			\n"
+			"mov %1, lr			\n"
+			"msr cpsr_c, r3		\n"
+			: "=r"(sp), "=r"(lr) : : "r3", "memory");
+	}
+
+	snapshot->sp = sp;
+	snapshot->lr = lr;
+#endif
+}
+
+static void CaptureStack()
+{
+	const uint32_t* stackTop = reinterpret_cast<const uint32_t*>(snapshot->sp);
+
+	// A corrupted stack pointer must not cause another fault
+	if((0 == snapshot->sp) || (0 != (snapshot->sp & 0x3)))
+		return;
+
+	for(uint8_t idx = 0; idx < WDT_SNAPSHOT_STACK_WORDS; ++idx)
+		snapshot->stack[idx] = stackTop[idx];
+
+	snapshot->stackWords = WDT_SNAPSHOT_STACK_WORDS;
+}
+
+void PreTimeoutInit(XScuTimer* timer, uint32_t watchdogLoad, uint32_t margin)
+{
+	if((nullptr == timer) || (margin >= watchdogLoad))
+		while(1);
+
+	p_timer 		= timer;
+	preTimeoutLoad 	= watchdogLoad - margin;
+
+	// Single shot, restarted by the application along with the watchdog
+	XScuTimer_Stop(p_timer);
+	XScuTimer_DisableAutoReload(p_timer);
+	XScuTimer_ClearInterruptStatus(p_timer);
+	XScuTimer_EnableInterrupt(p_timer);
+
+	PreTimeoutRestart();
+}
+
+void PreTimeoutSetIsrVectors(const uint32_t* ids, uint8_t count)
+{
+	isrVectors 		= ids;
+	isrVectorCount 	= (count < WDT_SNAPSHOT_MAX_ISR_COUNTERS) ? count : WDT_SNAPSHOT_MAX_ISR_COUNTERS;
+}
+
+void PreTimeoutRestart()
+{
+	// Pre-timeout is optional, the boot might have gone on without it
+	if(nullptr == p_timer)
+		return;
+
+	XScuTimer_Stop(p_timer);
+	XScuTimer_LoadTimer(p_timer, preTimeoutLoad);
+	XScuTimer_Start(p_timer);
+
+	// The loop recovered within the margin, the snapshot explains no reset
+	if(b_captured)
+	{
+		b_captured = false;
+		PreTimeoutClearSnapshot();
+	}
+}
+
+void PreTimeoutIrqHandler(XScuTimer* timer)
+{
+	XScuTimer_ClearInterruptStatus(timer);
+
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	memset(snapshot, 0, sizeof(WdtCrashSnapshot));
+	snapshot->magic 	= WDT_SNAPSHOT_MAGIC;
+	snapshot->timestamp = uint32_t(now);
+
+	CaptureRegisters();
+	CaptureStack();
+
+	// The running priority would be this ISR's own, the pending one tells what waits behind it
+	snapshot->gicHighestPending = Xil_In32(XPAR_SCUGIC_CPU_BASEADDR + XSCUGIC_HI_PEND_OFFSET);
+
+	// Counted by the GIC vector table
+	snapshot->isrCounterCount = isrVectorCount;
+	for(uint8_t idx = 0; idx < isrVectorCount; ++idx)
+	{
+		snapshot->isrVectors[idx] 	= uint16_t(isrVectors[idx]);
+		snapshot->isrCounters[idx] 	= GicGetCount(isrVectors[idx]);
+	}
+
+	snapshot->logCount = uint8_t(DeferredLogSnapshot(snapshot->logs, WDT_SNAPSHOT_LOG_RECORDS));
+
+	snapshot->checksum = CalcChecksum(*snapshot);
+
+	// The OCM is cached, the snapshot must reach the memory before the reset
+	Xil_DCacheFlushRange(UINTPTR(snapshot), sizeof(WdtCrashSnapshot));
+
+	b_captured = true;
+
+	// Let the supervisor tell which task stalled
+	WdtSupervisorCapture();
+}
+
+bool PreTimeoutGetSnapshot(WdtCrashSnapshot& copy)
+{
+	if((WDT_SNAPSHOT_MAGIC != snapshot->magic) || (CalcChecksum(*snapshot) != snapshot->checksum))
+		return false;
+
+	memcpy(&copy, snapshot, sizeof(WdtCrashSnapshot));
+
+	return true;
+}
+
+void PreTimeoutClearSnapshot()
+{
+	snapshot->magic = 0;
+	Xil_DCacheFlushRange(UINTPTR(snapshot), sizeof(WdtCrashSnapshot));
+}
@@ -0,0 +1,71 @@
+/**
+ * @file 	WatchdogPreTimeout.h
+ * @brief	Pre-timeout warning of the SCU watchdog with crash snapshot capture.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> GIC running priority removed from the snapshot.
+ * 			October 19, 2026 -> Snapshot withdrawn once the watchdog is restarted again.
+ *
+ * @note	In watchdog mode, the SCU watchdog resets the system without raising an interrupt,
+ * 			its interrupt is only generated in timer mode. Thus, the SCU private timer shadows the
+ * 			watchdog. It is loaded with the watchdog timeout minus a margin and restarted whenever
+ * 			the watchdog is restarted. Both timers are clocked at half the CPU frequency. If the
+ * 			private timer expires, the watchdog will reset the system within the margin, so the
+ * 			interrupt handler captures a snapshot of the stalled context into the high OCM.
+ * 			If the watchdog is restarted within the margin after all, the next restart clears
+ * 			the snapshot again.
+ *
+ * 			The handler must be bound to XPAR_PS7_SCUTIMER_0_INTR. The interrupted context is
+ * 			assumed to run in the system mode (as the standalone BSP does). Its PC is read from
+ * 			the frame that the BSP IRQ vector pushes to the top of the IRQ stack.
+ *
+ * 			The BSP doesn't nest interrupts, thus the interrupted context is never another ISR.
+ * 			A stall inside an ISR, or anywhere else with the interrupts masked, keeps this
+ * 			interrupt from being taken and leaves no snapshot, only the reset itself.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xscutimer.h"
+#include "DeferredLog.h"
+
+/** Definitions **/
+#define WDT_SNAPSHOT_STACK_WORDS		16		// Words copied from the top of the interrupted stack
+#define WDT_SNAPSHOT_MAX_ISR_COUNTERS 	8		// Vectors whose GIC counters are captured
+#define WDT_SNAPSHOT_LOG_RECORDS 		8		// Most recent deferred log records
+
+// Right below the post-mortem record of the supervisor
+#ifndef WDT_SNAPSHOT_ADDRESS
+#define WDT_SNAPSHOT_ADDRESS			0xFFFFF800
+#endif
+
+#define WDT_SNAPSHOT_MAGIC				0x57445453	// "WDTS"
+
+/** Custom Structures **/
+struct WdtCrashSnapshot{
+	uint32_t 			magic;
+	uint32_t 			timestamp;								// Lower half of the global timer
+	uint32_t 			pc;										// Interrupted instruction
+	uint32_t 			lr;
+	uint32_t 			sp;
+	uint32_t 			cpsr;									// Of the interrupted context
+	uint32_t 			gicHighestPending;						// Interrupt waiting behind this one, 1023 if none
+	uint32_t 			stack[WDT_SNAPSHOT_STACK_WORDS];
+	uint8_t 			stackWords;
+	uint8_t 			isrCounterCount;
+	uint8_t 			logCount;
+	uint8_t 			reserved;
+	uint16_t 			isrVectors[WDT_SNAPSHOT_MAX_ISR_COUNTERS];	// Interrupt IDs
+	uint32_t 			isrCounters[WDT_SNAPSHOT_MAX_ISR_COUNTERS];
+	DeferredLogRecord 	logs[WDT_SNAPSHOT_LOG_RECORDS];
+	uint32_t 			checksum;								// Sum of the words above
+};
+
+/** Function Declarations **/
+void 	PreTimeoutInit(XScuTimer* timer, uint32_t watchdogLoad, uint32_t margin);	// Values in watchdog ticks
+void 	PreTimeoutSetIsrVectors(const uint32_t* ids, uint8_t count);				// Their counters are included in the snapshot
+void 	PreTimeoutRestart();														// Call along with each watchdog restart
+void 	PreTimeoutIrqHandler(XScuTimer* timer);
+bool 	PreTimeoutGetSnapshot(WdtCrashSnapshot& snapshot);							// Returns false if there is no valid snapshot
+void 	PreTimeoutClearSnapshot();
@@ -0,0 +1,201 @@
+/**
+ * @file 	WatchdogSupervisor.cpp
+ * @brief	Software supervisor of multiple tasks on top of the SCU watchdog timer.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Stalled service loop recorded as the failure.
+ * 			October 19, 2026 -> Capture withdrawn once the service recovers.
+ */
+
+/** Libraries **/
+#include "WatchdogSupervisor.h"
+#include "xil_cache.h"
+#include <stddef.h>
+#include <string.h>
+
+/** Custom Structures **/
+struct SupervisedTask{
+	const char* 		name 			= nullptr;
+	uint32_t 			timeout 		= 0;
+	volatile uint32_t 	lastHeartbeat 	= 0;
+};
+
+/** Global Variables **/
+static XScuWdt* 		watchdog 	= nullptr;
+static SupervisedTask 	tasks[WDT_SUPERVISOR_MAX_TASKS];
+static uint8_t 			taskCount 	= 0;
+static bool 			b_failed 	= false;
+static bool 			b_captured 	= false;	// A capture is pending, the reset may still not come
+
+// Not a linker section, the record must stay where the previous boot left it
+static WdtPostMortem* const postMortem = reinterpret_cast<WdtPostMortem*>(WDT_POSTMORTEM_ADDRESS);
+
+static uint32_t Now()
+{
+	XTime now = 0;
+	XTime_GetTime(&now);
+
+	return uint32_t(now);
+}
+
+static uint32_t CalcChecksum(const WdtPostMortem& record)
+{
+	const uint32_t* words = reinterpret_cast<const uint32_t*>(&record);
+	uint32_t checksum = 0;
+
+	for(size_t idx = 0; idx < (offsetof(WdtPostMortem, checksum) / sizeof(uint32_t)); ++idx)
+		checksum += words[idx];
+
+	return checksum;
+}
+
+static bool IsRecordValid()
+{
+	return (WDT_POSTMORTEM_MAGIC == postMortem->magic) && (CalcChecksum(*postMortem) == postMortem->checksum);
+}
+
+static void SealRecord()
+{
+	postMortem->checksum = CalcChecksum(*postMortem);
+
+	// The OCM is cached, the record must reach the memory before the reset
+	Xil_DCacheFlushRange(UINTPTR(postMortem), sizeof(WdtPostMortem));
+}
+
+static void SavePostMortem(const uint8_t failedTask, const uint32_t now)
+{
+	// Power-up content of the OCM is random, count only the valid records
+	const uint32_t resetCount = IsRecordValid() ? (postMortem->resetCount + 1) : 1;
+
+	memset(postMortem, 0, sizeof(WdtPostMortem));
+
+	postMortem->magic 		= WDT_POSTMORTEM_MAGIC;
+	postMortem->resetCount 	= resetCount;
+	postMortem->timestamp 	= now;
+	postMortem->failedTask 	= failedTask;
+	postMortem->taskCount 	= taskCount;
+
+	const char* const name = (WDT_SUPERVISOR_SERVICE_TASK == failedTask) ? "Service loop" : tasks[failedTask].name;
+	strncpy(postMortem->failedTaskName, name, WDT_SUPERVISOR_NAME_SIZE - 1);
+
+	for(uint8_t id = 0; id < taskCount; ++id)
+	{
+		postMortem->timeouts[id] 		= tasks[id].timeout;
+		postMortem->lastHeartbeats[id] 	= tasks[id].lastHeartbeat;
+	}
+
+	SealRecord();
+}
+
+void WdtSupervisorInit(XScuWdt* instance)
+{
+	if(nullptr == instance)
+		while(1);
+
+	watchdog 	= instance;
+	taskCount 	= 0;
+	b_failed 	= false;
+	b_captured 	= false;
+}
+
+uint8_t WdtSupervisorRegister(const char* name, uint32_t timeout)
+{
+	if((nullptr == name) || (0 == timeout) || (WDT_SUPERVISOR_MAX_TASKS == taskCount))
+		return WDT_SUPERVISOR_INVALID_TASK;
+
+	SupervisedTask& task = tasks[taskCount];
+
+	task.name 			= name;
+	task.timeout 		= timeout;
+	task.lastHeartbeat 	= Now();
+
+	return taskCount++;
+}
+
+void WdtSupervisorHeartbeat(uint8_t taskId)
+{
+	if(taskId < taskCount)
+		tasks[taskId].lastHeartbeat = Now();
+}
+
+bool WdtSupervisorService()
+{
+	if(b_failed)
+		return false;
+
+	for(uint8_t id = 0; id < taskCount; ++id)
+	{
+		// Sample the heartbeat first so that a heartbeat from an ISR can't be newer than now
+		const uint32_t lastHeartbeat = tasks[id].lastHeartbeat;
+		const uint32_t now = Now();
+
+		if((now - lastHeartbeat) > tasks[id].timeout)
+		{
+			// Stop restarting the hardware, it will reset the system shortly
+			SavePostMortem(id, now);
+			b_failed = true;
+
+			return false;
+		}
+	}
+
+	XScuWdt_RestartWdt(watchdog);
+
+	// The service recovered within the pre-timeout margin, there will be no reset to explain
+	if(b_captured)
+	{
+		b_captured = false;
+
+		--postMortem->resetCount;
+		postMortem->failedTask = WDT_SUPERVISOR_INVALID_TASK;
+		SealRecord();
+	}
+
+	return true;
+}
+
+void WdtSupervisorCapture()
+{
+	// Failure has already been recorded by the service or by an earlier capture
+	if(b_failed || b_captured || (0 == taskCount))
+		return;
+
+	// An overdue task would have been noticed by a running service, otherwise the service is stalled
+	uint8_t culprit 	= WDT_SUPERVISOR_SERVICE_TASK;
+	int32_t maxLateness = 0;
+
+	for(uint8_t id = 0; id < taskCount; ++id)
+	{
+		const uint32_t lastHeartbeat 	= tasks[id].lastHeartbeat;
+		const int32_t lateness 			= int32_t((Now() - lastHeartbeat) - tasks[id].timeout);
+
+		if(lateness > maxLateness)
+		{
+			maxLateness = lateness;
+			culprit 	= id;
+		}
+	}
+
+	SavePostMortem(culprit, Now());
+	b_captured = true;
+}
+
+bool WdtSupervisorGetPostMortem(WdtPostMortem& record)
+{
+	if(!IsRecordValid() || (WDT_SUPERVISOR_INVALID_TASK == postMortem->failedTask))
+		return false;
+
+	record = *postMortem;
+
+	return true;
+}
+
+void WdtSupervisorClearPostMortem()
+{
+	if(!IsRecordValid())
+		return;
+
+	// Reset count is kept for the upcoming records
+	postMortem->failedTask = WDT_SUPERVISOR_INVALID_TASK;
+	SealRecord();
+}
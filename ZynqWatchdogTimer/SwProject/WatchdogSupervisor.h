@@ -0,0 +1,71 @@
+/**
+ * @file 	WatchdogSupervisor.h
+ * @brief	Software supervisor of multiple tasks on top of the SCU watchdog timer.
+ * @author	Caglayan DOKME, caglayandokme@gmail.com
+ * @date	October 19, 2026 -> Created
+ * 			October 19, 2026 -> Stalled service loop recorded as the failure.
+ * 			October 19, 2026 -> Capture withdrawn once the service recovers.
+ *
+ * @note	Each task registers a heartbeat with its own timeout. WdtSupervisorService() restarts
+ * 			the hardware watchdog only if every task has beaten within its timeout. Once a task
+ * 			misses its deadline, a post-mortem record is saved and the hardware watchdog is
+ * 			left to expire. The record is kept in the high OCM, which survives the reset, and
+ * 			can be read back after the reboot.
+ *
+ * 			WdtSupervisorService() is the only thing that restarts the hardware watchdog, thus
+ * 			it must be called more often than the hardware timeout (minus the pre-timeout
+ * 			margin, if used). The loop calling it is supervised by the hardware itself, a
+ * 			heartbeat from that same loop would add nothing. Task timeouts may be longer than
+ * 			the hardware timeout, a failed task resets the system within its timeout plus a
+ * 			service period plus the hardware timeout.
+ *
+ * 			If the service stops being called, WdtSupervisorCapture() (called before the
+ * 			imminent reset) records the service loop as the failure unless a task is overdue.
+ * 			If the service recovers before the reset, the next successful service withdraws
+ * 			that record, so that a later reset of another kind doesn't report it.
+ */
+
+#pragma once
+
+/** Libraries **/
+#include "xscuwdt.h"
+#include "xtime_l.h"
+
+/** Definitions **/
+#define WDT_SUPERVISOR_MAX_TASKS 	8
+#define WDT_SUPERVISOR_NAME_SIZE 	16
+#define WDT_SUPERVISOR_INVALID_TASK	0xFF
+#define WDT_SUPERVISOR_SERVICE_TASK	0xFE	// Failed task of a stalled service loop
+
+// Top of the high OCM, below the area reserved by the boot ROM (0xFFFFFE00)
+// The FSBL must not use this area, move it if a different boot loader does
+#ifndef WDT_POSTMORTEM_ADDRESS
+#define WDT_POSTMORTEM_ADDRESS		0xFFFFFC00
+#endif
+
+#define WDT_POSTMORTEM_MAGIC		0x57445450	// "WDTP"
+
+// Timestamps are the lower half of the global timer, thus timeouts must be shorter than ~12s
+#define WDT_SUPERVISOR_MS_TO_TICKS(ms)	uint32_t((uint64_t(COUNTS_PER_SECOND) * (ms)) / 1000)
+
+/** Custom Structures **/
+struct WdtPostMortem{
+	uint32_t 	magic;
+	uint32_t 	resetCount;									// Watchdog resets recorded since the power-up
+	uint32_t 	timestamp;									// Time of the detection
+	uint8_t 	failedTask;
+	uint8_t 	taskCount;
+	char 		failedTaskName[WDT_SUPERVISOR_NAME_SIZE];
+	uint32_t 	timeouts[WDT_SUPERVISOR_MAX_TASKS];
+	uint32_t 	lastHeartbeats[WDT_SUPERVISOR_MAX_TASKS];
+	uint32_t 	checksum;									// Sum of the words above
+};
+
+/** Function Declarations **/
+void 	WdtSupervisorInit(XScuWdt* watchdog);
+uint8_t WdtSupervisorRegister(const char* name, uint32_t timeout);	// Returns the task ID, timeout in global timer ticks
+void 	WdtSupervisorHeartbeat(uint8_t taskId);						// Can be called from ISRs
+bool 	WdtSupervisorService();										// Call periodically, returns false once a task fails
+void 	WdtSupervisorCapture();										// Records the most overdue task, for use before an imminent reset
+bool 	WdtSupervisorGetPostMortem(WdtPostMortem& record);			// Returns false if there is no valid record
+void 	WdtSupervisorClearPostMortem();
@@ -2,13 +2,29 @@
  * @brief	  	Main software file for using Zynq Watchdog Timer
  * @author		Caglayan DOKME, caglayandokme@gmail.com
  * @date	  	September 26, 2021 -> Created
+ * 				October 19, 2026 -> Deferred logging added.
+ * 				October 19, 2026 -> Multi-task software supervisor added.
+ * 				October 19, 2026 -> Pre-timeout crash snapshot added.
+ * 				October 19, 2026 -> Boot manager with fast-boot profile added.
+ * 				October 19, 2026 -> GIC vector table added.
+ * 				October 19, 2026 -> GIC stage made critical, GPIO brought up after the first service.
+ * 				October 19, 2026 -> GIC running priority removed from the snapshot report.
+ * 				October 19, 2026 -> Loop task removed, the hardware supervises the loop.
+ * 				October 19, 2026 -> Failure records printed only after a watchdog reset.
+ * 				October 19, 2026 -> Printed durations rounded to the nearest millisecond.
  */
 
  /** Libraries **/
 #include "xparameters.h"
 #include "xgpiops.h"
 #include "xscugic.h"
+#include "GicVectorTable.h"
 #include "xscuwdt.h"
+#include "xscutimer.h"
+#include "DeferredLog.h"
+#include "WatchdogSupervisor.h"
+#include "WatchdogPreTimeout.h"
+#include "BootManager.h"
 #include <stdio.h>
 
 /** Definitions **/
@@ -18,6 +34,11 @@
 #define WDT_TIMER_250MS_VALUE	(WDT_TIMER_1S_VALUE / 4)
 #define WDT_TIMER_100MS_VALUE	(WDT_TIMER_1S_VALUE / 10)
 
+// The hardware watchdog is restarted only if all the supervised tasks are healthy
+#define WDT_HARDWARE_TIMEOUT	WDT_TIMER_1S_VALUE
+#define WDT_PRE_TIMEOUT_MARGIN	WDT_TIMER_100MS_VALUE	// Snapshot is taken this long before the reset
+#define BUTTON_TIMEOUT_MS		5000	// Press the button at least this often
+
 #define PIN_BTN8	50
 
 #define TYPE_INPUT	0
@@ -29,45 +50,78 @@
 #define	HIGH 		1
 #define	LOW 		0
 
+// Deferred log formats, decode with Common/DeferredLogDecoder.py
+#define LOG_FORMATS(FORMAT)							\
+	FORMAT(LOG_WATCHDOG_PRE_TIMEOUT, "Watchdog is about to expire!\n")	\
+	FORMAT(LOG_BUTTON_PRESSED, "Button pressed!\n")
+
+DLOG_DEFINE_FORMATS(LOG_FORMATS)
+
 /** Hardware Instances **/
 XGpioPs gpio;
 XScuGic gic;
 XScuWdt watchdog;
+XScuTimer shadowTimer;	// Raises the pre-timeout interrupt of the watchdog
+
+/** Custom Structures **/
+enum BootStageIndex : uint8_t {
+	STAGE_WATCHDOG = 0,
+	STAGE_PRE_TIMEOUT,
+	STAGE_SUPERVISOR,
+	STAGE_GIC,
+	STAGE_GPIO,
+	STAGE_COUNT
+};
 
 /** Global Variables **/
 volatile bool b_btnIrqFlag = false;
+// Interrupt counters of these vectors are included in the pre-timeout snapshot
+const uint32_t snapshotVectors[] = {XPS_GPIO_INT_ID, XPAR_PS7_SCUTIMER_0_INTR};
+uint8_t buttonTask 	= WDT_SUPERVISOR_INVALID_TASK;
 
-void GpioIrqHandler(void* arguments)
+void GpioIrqHandler(void* arguments, u32 bank, u32 status)
 {
 	if(HIGH == XGpioPs_ReadPin(&gpio, PIN_BTN8))
 		b_btnIrqFlag = true;
 }
 
-void WatchdogIrqHandler(void* arguments)
+void WatchdogPreTimeoutIrqHandler(XScuTimer* timer)
 {
-	printf("Watchdog expired!\n");
+	// Logged before the capture, so that it becomes a part of the snapshot
+	DeferredLog(LOG_WATCHDOG_PRE_TIMEOUT);
+
+	PreTimeoutIrqHandler(timer);
 }
 
-void InitGpio()
-{
-	uint32_t errCode = 0;
+/** Interrupt Vector Table **/
+// The watchdog raises no interrupt in watchdog mode, its pre-timeout is signaled by the shadow timer
+constexpr GicBinding gicBindings[] = {
+	GIC_BIND(XPAR_PS7_SCUTIMER_0_INTR, WatchdogPreTimeoutIrqHandler, &shadowTimer)
+};
+
+// Attached by the lazy GPIO stage
+constexpr GicBinding gpioBinding = GIC_BIND(XPS_GPIO_INT_ID, XGpioPs_IntrHandler, &gpio);
 
+bool InitGpio()
+{
 	// Find the related configuration
 	XGpioPs_Config* config = XGpioPs_LookupConfig(XPAR_PS7_GPIO_0_DEVICE_ID);
 
 	// Check if the configuration is found
 	if(nullptr == config)
-		while(1);
+		return false;
 
 	// Initialize the driver using the given configuration
-	errCode = XGpioPs_CfgInitialize(&gpio, config, config->BaseAddr);
-	if(XST_SUCCESS != errCode)
-		while(1);
+	return XST_SUCCESS == XGpioPs_CfgInitialize(&gpio, config, config->BaseAddr);
+}
 
-	errCode = XGpioPs_SelfTest(&gpio);
-	if(XST_SUCCESS != errCode)
-		while(1);
+bool TestGpio()
+{
+	return XST_SUCCESS == XGpioPs_SelfTest(&gpio);
+}
 
+bool StartGpio()
+{
 	// Declare input pins (JE7, JE8, JE9, JE10)
 	XGpioPs_SetDirectionPin(&gpio, PIN_BTN8,  TYPE_INPUT);
 
@@ -75,104 +129,251 @@ void InitGpio()
 	XGpioPs_SetIntrTypePin(&gpio, PIN_BTN8, XGPIOPS_IRQ_TYPE_EDGE_RISING);
 
 	// Declare a callback function for the PS GPIO interrupt
-	XGpioPs_SetCallbackHandler(&gpio, &gpio, (XGpioPs_Handler)GpioIrqHandler);
+	XGpioPs_SetCallbackHandler(&gpio, &gpio, GpioIrqHandler);
 
 	// Enable the interrupt generation of PS GPIO
 	XGpioPs_IntrEnablePin(&gpio, PIN_BTN8);
+
+	// The GIC stage is a dependency of this one, thus it is usable by now
+	return XST_SUCCESS == GicAttach(&gpioBinding, 1);
+}
+
+bool InitGic()
+{
+	// Self-test is a separate stage step
+	return XST_SUCCESS == GicInit(&gic, false);
+}
+
+bool TestGic()
+{
+	// Only reads the identification registers, safe to run later
+	return XST_SUCCESS == XScuGic_SelfTest(&gic);
 }
 
-void InitGic()
+bool StartGic()
 {
-	uint32_t errCode = 0;
+	if(XST_SUCCESS != GicAttach(gicBindings, sizeof(gicBindings) / sizeof(gicBindings[0])))
+		return false;
 
+	GicStart();
+
+	return true;
+}
+
+bool InitWatchdog()
+{
 	// Find the related configuration
-	XScuGic_Config* config = XScuGic_LookupConfig(XPAR_PS7_SCUGIC_0_DEVICE_ID);
+	XScuWdt_Config* config = XScuWdt_LookupConfig(XPAR_PS7_SCUWDT_0_DEVICE_ID);
 
 	// Check if the configuration is found
 	if(nullptr == config)
-		while(1);
+		return false;
 
 	// Initialize the driver using the given configuration
-	errCode = XScuGic_CfgInitialize(&gic, config, config->CpuBaseAddress);
-	if(XST_SUCCESS != errCode)
-		while(1);
-
-	errCode = XScuGic_SelfTest(&gic);
-	if(XST_SUCCESS != errCode)
-		while(1);
-
-	Xil_ExceptionInit();
+	return XST_SUCCESS == XScuWdt_CfgInitialize(&watchdog, config, config->BaseAddr);
+}
 
-	// Connect the IRQ controller handler to the hardware interrupt handling logic
-	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, Xil_ExceptionHandler(XScuGic_InterruptHandler), &gic);
+bool TestWatchdog()
+{
+	return XST_SUCCESS == XScuWdt_SelfTest(&watchdog);
+}
 
-	// Connect the PS GPIO device driver handler to the PS GPIO interrupt
-	XScuGic_Connect(&gic, XPS_GPIO_INT_ID, Xil_ExceptionHandler(XGpioPs_IntrHandler), &gpio);
+bool StartWatchdog()
+{
+	// Setup the timer as watch-dog timer
+	XScuWdt_SetWdMode(&watchdog);
 
-	// Connect the Watchdog timer IRQ handler to the related interrupt
-	XScuGic_Connect(&gic, XPS_SCU_WDT_INT_ID,(Xil_ExceptionHandler)WatchdogIrqHandler, &watchdog);
+	// Load the value
+	XScuWdt_LoadWdt(&watchdog, WDT_HARDWARE_TIMEOUT);
 
-	// Enable the interrupt from PS GPIO device
-	XScuGic_Enable(&gic, XPS_GPIO_INT_ID);
+	// Start the timer
+	XScuWdt_Start(&watchdog);
 
-	// Enable interrupts on the processor
-	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+	return true;
 }
 
-void InitWatchdog()
+bool InitShadowTimer()
 {
-	uint32_t errCode = 0;
-
 	// Find the related configuration
-	XScuWdt_Config* config = XScuWdt_LookupConfig(XPAR_PS7_SCUWDT_0_DEVICE_ID);
+	XScuTimer_Config* config = XScuTimer_LookupConfig(XPAR_PS7_SCUTIMER_0_DEVICE_ID);
 
 	// Check if the configuration is found
 	if(nullptr == config)
-		while(1);
+		return false;
 
 	// Initialize the driver using the given configuration
-	errCode = XScuWdt_CfgInitialize(&watchdog, config, config->BaseAddr);
-	if(XST_SUCCESS != errCode)
-		while(1);
+	return XST_SUCCESS == XScuTimer_CfgInitialize(&shadowTimer, config, config->BaseAddr);
+}
 
-	errCode = XScuWdt_SelfTest(&watchdog);
-	if(XST_SUCCESS != errCode)
-		while(1);
+bool TestShadowTimer()
+{
+	return XST_SUCCESS == XScuTimer_SelfTest(&shadowTimer);
+}
 
-	// Setup the timer as watch-dog timer
-	XScuWdt_SetWdMode(&watchdog);
+bool StartPreTimeout()
+{
+	// Started right after the watchdog so that both count down together
+	PreTimeoutInit(&shadowTimer, WDT_HARDWARE_TIMEOUT, WDT_PRE_TIMEOUT_MARGIN);
+	PreTimeoutSetIsrVectors(snapshotVectors, sizeof(snapshotVectors) / sizeof(snapshotVectors[0]));
 
-	// Load the value
-	XScuWdt_LoadWdt(&watchdog, WDT_TIMER_1S_VALUE * 5);
+	return true;
+}
 
-	// Start the timer
-	XScuWdt_Start(&watchdog);
+bool InitSupervisor()
+{
+	WdtSupervisorInit(&watchdog);
+
+	// The loop itself needs no task, it is the one restarting the hardware watchdog
+	buttonTask = WdtSupervisorRegister("Button", WDT_SUPERVISOR_MS_TO_TICKS(BUTTON_TIMEOUT_MS));
+
+	return WDT_SUPERVISOR_INVALID_TASK != buttonTask;
+}
+
+// Peripheral bring-up order, the watchdog comes first to protect the rest of the boot
+const BootStage bootStages[STAGE_COUNT] = {
+	{"Watchdog", 	InitWatchdog, 		TestWatchdog, 		StartWatchdog, 		BOOT_STAGE_CRITICAL},
+	{"PreTimeout", 	InitShadowTimer, 	TestShadowTimer, 	StartPreTimeout, 	0},
+	{"Supervisor", 	InitSupervisor, 	nullptr, 			nullptr, 			BOOT_STAGE_CRITICAL},
+	{"GIC", 		InitGic, 			TestGic, 			StartGic, 			BOOT_STAGE_CRITICAL | BOOT_STAGE_TEST_DEFERRABLE},
+	{"GPIO", 		InitGpio, 			TestGpio, 			StartGpio, 			BOOT_STAGE_LAZY, 	BOOT_DEPENDS_ON(STAGE_GIC)}	// Brought up after the first watchdog service
+};
+
+bool WasResetByWatchdog()
+{
+	// The driver is not initialized yet, read the reset status directly
+	return 0 != (Xil_In32(XPAR_PS7_SCUWDT_0_BASEADDR + XSCUWDT_RST_STS_OFFSET) & XSCUWDT_RST_STS_RESET_FLAG_MASK);
+}
+
+void PrintPostMortem()
+{
+	WdtPostMortem record;
+
+	if(!WdtSupervisorGetPostMortem(record))
+		return;
+
+	printf("Watchdog reset #%u, task \"%s\" missed its deadline\n", unsigned(record.resetCount), record.failedTaskName);
+
+	// Time elapsed since the last heartbeat of each task at the detection moment
+	for(uint8_t id = 0; (id < record.taskCount) && (id < WDT_SUPERVISOR_MAX_TASKS); ++id)
+	{
+		// Rounded to the nearest, a timeout of 50ms is 16666667 ticks and would truncate to 49ms
+		const uint32_t elapsedMs = uint32_t(((uint64_t(record.timestamp - record.lastHeartbeats[id]) * 1000) + (COUNTS_PER_SECOND / 2)) / COUNTS_PER_SECOND);
+		const uint32_t timeoutMs = uint32_t(((uint64_t(record.timeouts[id]) * 1000) + (COUNTS_PER_SECOND / 2)) / COUNTS_PER_SECOND);
+
+		printf("  Task %u: last heartbeat %ums ago (timeout %ums)\n", unsigned(id), unsigned(elapsedMs), unsigned(timeoutMs));
+	}
+
+	// Report it only once
+	WdtSupervisorClearPostMortem();
+}
+
+void PrintSnapshot()
+{
+	WdtCrashSnapshot snapshot;
+
+	if(!PreTimeoutGetSnapshot(snapshot))
+		return;
+
+	printf("Pre-timeout snapshot:\n");
+	printf("  PC: 0x%08X, LR: 0x%08X, SP: 0x%08X, CPSR: 0x%08X\n", unsigned(snapshot.pc), unsigned(snapshot.lr), unsigned(snapshot.sp), unsigned(snapshot.cpsr));
+	printf("  GIC highest pending: %u\n", unsigned(snapshot.gicHighestPending & 0x3FF));
+
+	for(uint8_t idx = 0; (idx < snapshot.stackWords) && (idx < WDT_SNAPSHOT_STACK_WORDS); ++idx)
+		printf("  SP+0x%02X: 0x%08X\n", unsigned(idx * 4), unsigned(snapshot.stack[idx]));
+
+	for(uint8_t idx = 0; (idx < snapshot.isrCounterCount) && (idx < WDT_SNAPSHOT_MAX_ISR_COUNTERS); ++idx)
+		printf("  IRQ %u count: %u\n", unsigned(snapshot.isrVectors[idx]), unsigned(snapshot.isrCounters[idx]));
+
+	// Format strings are not in the image, look the IDs up in the LOG_FORMATS list
+	for(uint8_t idx = 0; (idx < snapshot.logCount) && (idx < WDT_SNAPSHOT_LOG_RECORDS); ++idx)
+	{
+		const DeferredLogRecord& log = snapshot.logs[idx];
+
+		printf("  Log @%u: format %u", unsigned(log.timestamp), unsigned(log.formatId));
+
+		for(uint8_t arg = 0; (arg < log.argCount) && (arg < DLOG_MAX_ARGS); ++arg)
+			printf(" 0x%08X", unsigned(log.args[arg]));
+
+		printf("\n");
+	}
+
+	// Report it only once
+	PreTimeoutClearSnapshot();
 }
 
 int main()
 {
+	// Recover quickly after a watchdog reset, the peripherals were verified at the power-up
+	const bool b_watchdogReset = WasResetByWatchdog();
+
 	// Initialize the system
-	InitWatchdog();
-	InitGpio();
-	InitGic();
+	if(!BootRun(bootStages, STAGE_COUNT, b_watchdogReset ? BOOT_PROFILE_FAST : BOOT_PROFILE_FULL))
+	{
+		BootPrintReport();
+		while(1);
+	}
 
 	// Check if the system had been reset due to
 	// Watchdog expiration or a normal power-up
-	if(XScuWdt_IsWdtExpired(&watchdog))
+	if(b_watchdogReset)
+	{
 		printf("System had been reset due to Watchdog!\n");
+
+		// The flag survives the resets other than the power-on reset, clear it for the next boot
+		XScuWdt_WriteReg(watchdog.Config.BaseAddr, XSCUWDT_RST_STS_OFFSET, XSCUWDT_RST_STS_RESET_FLAG_MASK);
+	}
 	else
+	{
 		printf("System powered up normally..\n");
+	}
+
+	// Details of the failure saved before the reset, records left by any other reset explain nothing
+	if(b_watchdogReset)
+	{
+		PrintPostMortem();
+		PrintSnapshot();
+	}
+	else
+	{
+		WdtSupervisorClearPostMortem();
+		PreTimeoutClearSnapshot();
+	}
+
+	bool b_bootCompleted = false;
 
 	// Application loop
 	while(1)
 	{
-		// Wait until the button is pressed
-		while(!b_btnIrqFlag);
-		b_btnIrqFlag = false;
+		// Set only once the GPIO stage is up
+		if(b_btnIrqFlag)
+		{
+			b_btnIrqFlag = false;
+
+			WdtSupervisorHeartbeat(buttonTask);
+			DeferredLog(LOG_BUTTON_PRESSED);
+		}
+
+		// Restart the Watchdog timer (and its shadow) only if every task is healthy
+		if(WdtSupervisorService())
+			PreTimeoutRestart();
+
+		// Stream out the pending logs
+		DeferredLogFlush();
+
+		// Finish the boot once the first useful work is done
+		if(!b_bootCompleted)
+		{
+			// The GIC keeps running, but nothing new is attached to it
+			if(!BootRunDeferredSelfTests())
+				printf("Deferred self-test failed!\n");
+
+			// The button deadline is seconds away, its pin isn't needed for the first service
+			if(!BootRequire(STAGE_GPIO))
+				printf("Button is not available, the supervisor will reset the system!\n");
 
-		// Restart the Watchdog timer so that it doesn't expire
-		XScuWdt_RestartWdt(&watchdog);
+			BootPrintReport();
 
-		printf("Button pressed!\n");
+			b_bootCompleted = true;
+		}
 	}
 }